@@ -40,7 +40,7 @@ function(_add_library_tests TARGET_NAME)
 
       set_tests_properties(${testname} PROPERTIES
         LABELS ${category}
-        ENVIRONMENT "MCRL2_COMPILEREWRITER=${CMAKE_RUNTIME_OUTPUT_DIRECTORY}/mcrl2compilerewriter")
+        ENVIRONMENT "MCRL2_COMPILEREWRITER=${CMAKE_RUNTIME_OUTPUT_DIRECTORY}/mcrl2compilerewriter;MCRL2_COMPILECACHE=${CMAKE_BINARY_DIR}/jittyc_cache")
     endforeach()
   endforeach()
 endfunction()
@@ -47,5 +47,10 @@ if(NOT ${MCRL2_ENABLE_DEBUG_SOUNDNESS_CHECKS})
   add_definitions(-DMCRL2_NO_SOUNDNESS_CHECKS)
 endif()
 
+# Add the definition that makes the term library thread safe.
+if(${MCRL2_ENABLE_MULTITHREADING})
+  add_definitions(-DMCRL2_THREAD_SAFE)
+endif()
+
 # Check supported C++11 features
 include(CheckCXX11Features)
@@ -380,7 +380,7 @@ endfunction()
 
 # pbespgsolve
 function(gen_pbespgsolve_release_tests PBESFILE)
-  set(ARGUMENTS "" "-c" "-C" "-L" "-e" "-sspm" "-saltspm" "-srecursive" "-rjitty" "-rjittyp" ${_JITTYC})
+  set(ARGUMENTS "" "-c" "-C" "-L" "-e" "-sspm" "-saltspm" "-srecursive" "-sparrecursive" "-rjitty" "-rjittyp" ${_JITTYC})
   foreach(arglist ${ARGUMENTS})
     add_tool_test(pbespgsolve ${arglist} ${tagIN} ${PBESFILE})
   endforeach()
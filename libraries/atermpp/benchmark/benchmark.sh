@@ -15,3 +15,12 @@ echo "Running nested function application with trivial converter benchmark from
 for i in 0 1 2 4 7 8 12 16 20 26 32; do
   perf stat benchmark_atermpp_function_application_with_converter_creation $i
 done;
+
+echo "Running the benchmarks with multiple threads, requires MCRL2_ENABLE_MULTITHREADING"
+for t in 2 4 8; do
+  perf stat benchmark_atermpp_integer_term_creation $t
+  perf stat benchmark_atermpp_list_creation $t
+  perf stat benchmark_atermpp_function_symbol_creation $t
+  perf stat benchmark_atermpp_garbage_collection_parallel $t
+  perf stat benchmark_atermpp_function_application_creation 8 $t
+done;
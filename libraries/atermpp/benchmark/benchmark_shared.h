@@ -10,26 +10,54 @@
 #include "mcrl2/atermpp/aterm_appl.h"
 
 #include "mcrl2/atermpp/detail/aterm_list.h"
+#include "mcrl2/atermpp/thread_aterm_pool.h"
 
+#include <algorithm>
+#include <iostream>
+#include <string>
 #include <vector>
 #include <thread>
 
 using namespace atermpp;
 
+/// \brief Parses the number of threads from the given argument, if present.
+/// \details Falls back to a single thread when the term library is not thread safe.
+inline std::size_t parse_number_of_threads(int argc, char* argv[], int index)
+{
+  std::size_t number_of_threads = 1;
+  if (argc > index)
+  {
+    number_of_threads = std::max(1, std::stoi(argv[index]));
+  }
+
+  if (number_of_threads > 1 && !detail::GlobalThreadSafe)
+  {
+    std::cerr << "The term library is not thread safe, running the benchmark with one thread.\n";
+    number_of_threads = 1;
+  }
+
+  return number_of_threads;
+}
+
 template<typename F>
 void benchmark_threads(std::size_t number_of_threads, F f)
 {
-  // Initialize a number of threads.
+  // Initialize a number of threads, each of them is registered with the term pool.
   std::vector<std::thread> threads(number_of_threads - 1);
   for (auto& thread : threads)
   {
-    thread = std::thread(f);
+    thread = std::thread([&f]()
+      {
+        thread_aterm_pool_registration registration;
+        f();
+      });
   }
 
   // Run the benchmark on the main thread as well.
   f();
 
-  // Wait for all threads to complete.
+  // Wait for all threads to complete, without blocking their garbage collection.
+  thread_aterm_pool_idle idle;
   for (auto& thread : threads)
   {
     thread.join();
@@ -18,9 +18,9 @@ int main(int argc, char* argv[])
   std::size_t number_of_arguments = 0;
   std::size_t size = 2000000;
   std::size_t iterations = 1000;
-  std::size_t number_of_threads = 1;
+  std::size_t number_of_threads = parse_number_of_threads(argc, argv, 2);
 
-  // Accept one argument for the number of arguments.
+  // Accept one argument for the number of arguments, the optional second argument is the number of threads.
   if (argc > 1)
   {
     // The first argument is the path of the executable.
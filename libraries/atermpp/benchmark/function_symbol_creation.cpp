@@ -18,11 +18,11 @@
 using namespace atermpp;
 
 /// \brief Benchmark the creation of function symbols
-int main(int, char*[])
+int main(int argc, char* argv[])
 {
   std::size_t amount = 50000;
   std::size_t iterations = 1000;
-  std::size_t number_of_threads = 1;
+  std::size_t number_of_threads = parse_number_of_threads(argc, argv, 1);
 
   // Define a function that repeatedly creates function symbols.
   auto create_function_symbols = [amount, iterations, number_of_threads](void) -> void
@@ -0,0 +1,39 @@
+// Author(s): Maurice Laveaux
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "benchmark_shared.h"
+
+#include "mcrl2/utilities/stopwatch.h"
+
+/// \brief Benchmark the creation of terms by several threads while garbage collection is
+///        triggered automatically, which stops all threads.
+int main(int argc, char* argv[])
+{
+  std::size_t amount = 1500000;
+  std::size_t iterations = 20;
+  std::size_t number_of_threads = parse_number_of_threads(argc, argv, 1);
+
+  auto create_terms = [amount, iterations, number_of_threads](void) -> void
+    {
+      stopwatch stopwatch;
+
+      for (std::size_t i = 0; i < iterations / number_of_threads; ++i)
+      {
+        // These terms become garbage at the end of every iteration.
+        aterm_appl f1 = create_nested_function("f", "c", 1, 1 * amount);
+        aterm_appl f4 = create_nested_function("h", "e", 4, amount/4);
+        aterm_appl f7 = create_nested_function<true>("i", "f", 7, amount/8);
+      }
+
+      std::cerr << "Creating terms with garbage collection took " << stopwatch.time() << " milliseconds.\n";
+    };
+
+  benchmark_threads(number_of_threads, create_terms);
+  return 0;
+}
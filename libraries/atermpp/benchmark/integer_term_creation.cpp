@@ -14,11 +14,11 @@
 
 using namespace atermpp;
 
-int main(int, char*[])
+int main(int argc, char* argv[])
 {
   std::size_t amount = 3000000;
   std::size_t iterations = 1000;
-  std::size_t number_of_threads = 1;
+  std::size_t number_of_threads = parse_number_of_threads(argc, argv, 1);
 
   // Define a function that repeatedly creates integers.
   auto create_integers = [amount, iterations, number_of_threads](void) -> void
@@ -54,11 +54,18 @@ public:
 ///          The start of the stream is a zero followed by a header and a version and a term with function symbol index zero
 ///          indicates the end of the stream.
 ///
+///          In the windowed format the stream is divided into blocks. Every block starts at a byte position and only shares
+///          terms and function symbols with terms in the same block. Hence, the memory needed to write and read the stream does
+///          not depend on its length, and a reader can start reading at any block. The stream ends with an index of the byte
+///          positions of the blocks.
+///
 class binary_aterm_output : public aterm_output
 {
 public:
   /// \brief Provide the output stream to which the terms are written.
-  binary_aterm_output(std::ostream& os);
+  /// \param block_size If non-zero, the windowed format is written, in which a new block is started as soon as the
+  ///        current block contains block_size shared terms. Otherwise all subterms are shared.
+  binary_aterm_output(std::ostream& os, std::size_t block_size = 0);
   ~binary_aterm_output() override;
 
   /// \brief Writes an aterm in a compact binary format that keeps subterms shared. The term that is
@@ -69,6 +76,12 @@ private:
   /// \brief Write a function symbol to the output stream.
   std::size_t write_function_symbol(const function_symbol& symbol);
 
+  /// \brief Ends the current block and starts a new one, which shares no terms with the previous blocks.
+  void start_block();
+
+  /// \brief Removes all written terms and function symbols from the indices.
+  void clear_indices();
+
   mcrl2::utilities::obitstream m_stream;
 
   /// \returns The number of bits needed to index terms.
@@ -82,6 +95,9 @@ private:
 
   mcrl2::utilities::indexed_set<aterm> m_terms; ///< An index of already written terms.
   mcrl2::utilities::indexed_set<function_symbol> m_function_symbols; ///< An index of already written function symbols.
+
+  std::size_t m_block_size; ///< The number of shared terms after which a new block is started, or zero.
+  std::vector<std::size_t> m_block_positions; ///< The byte positions of the blocks in the windowed format.
 };
 
 /// \brief Reads terms from a stream in the steamable binary aterm format.
@@ -89,13 +105,34 @@ class binary_aterm_input : public aterm_input
 {
 public:
   /// \brief Provide the input stream from which terms are read.
+  /// \details Both the format in which all subterms are shared and the windowed format can be read.
   binary_aterm_input(std::istream& is);
 
   aterm read_term() override;
 
+  /// \returns The number of blocks of the stream, which is one if it is not in the windowed format.
+  /// \details For the windowed format the index at the end of the stream is read, which requires that the input
+  ///          stream is seekable, and that the binary aterm stream is at the end of it.
+  std::size_t number_of_blocks();
+
+  /// \brief Continues reading at the start of the given block.
+  /// \details Requires a seekable input stream in the windowed format, see number_of_blocks().
+  void seek_block(std::size_t block);
+
 private:
+  /// \brief Removes all read terms and function symbols from the indices.
+  void clear_indices();
+
+  /// \brief Reads the index of the byte positions of the blocks at the end of the stream.
+  void read_block_positions();
+
+  std::istream& m_input;
+  std::istream::pos_type m_start; ///< The position of the binary aterm stream in m_input.
   mcrl2::utilities::ibitstream m_stream;
 
+  bool m_windowed; ///< The stream is in the windowed format.
+  std::vector<std::size_t> m_block_positions; ///< The byte positions of the blocks, once they have been read.
+
   /// \returns The number of bits needed to index terms.
   unsigned int term_index_width();
 
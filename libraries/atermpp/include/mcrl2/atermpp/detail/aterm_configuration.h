@@ -16,7 +16,14 @@ namespace detail
 {
 
 /// \brief Enables thread safety for the global term and function symbol pools.
+/// \details Set by the MCRL2_ENABLE_MULTITHREADING CMake option. In that case every thread
+///          other than the main thread that accesses terms must be registered using
+///          a thread_aterm_pool_registration object, see thread_aterm_pool.h.
+#ifdef MCRL2_THREAD_SAFE
+constexpr static bool GlobalThreadSafe = true;
+#else
 constexpr static bool GlobalThreadSafe = false;
+#endif
 
 /// \brief Enable to print garbage collection statistics.
 constexpr static bool EnableGarbageCollectionMetrics = false;
@@ -28,7 +35,9 @@ constexpr static bool EnableTermHashtableMetrics = false;
 constexpr static bool EnableTermCreationMetrics = false;
 
 /// \brief Enable garbage collection.
-constexpr static bool EnableGarbageCollection = true && !GlobalThreadSafe;
+/// \details When GlobalThreadSafe is enabled garbage collection stops all registered threads
+///          at their next term creation before marking and sweeping.
+constexpr static bool EnableGarbageCollection = true;
 
 } // namespace detail
 } // namespace atermpp
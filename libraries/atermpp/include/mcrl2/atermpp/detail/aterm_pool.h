@@ -15,6 +15,9 @@
 #include "mcrl2/atermpp/detail/aterm_pool_storage.h"
 #include "mcrl2/atermpp/detail/function_symbol_pool.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <tuple>
 
 namespace atermpp
@@ -39,6 +42,11 @@ using function_application_storage = aterm_pool_storage<_aterm_appl<N>, aterm_ha
 /// \details Internally uses different storage objects to store specific
 ///          classes of terms. For a given term creation it can decide what
 ///          storage to use at run-time using its function symbol.
+///
+///          When GlobalThreadSafe is enabled the storages can be accessed concurrently and
+///          garbage collection stops the world: the collecting thread waits until all other
+///          registered threads are either idle or have reached a safepoint, which is the
+///          start of every (outermost) term creation.
 class aterm_pool : public mcrl2::utilities::noncopyable
 {
 public:
@@ -69,6 +77,21 @@ public:
   /// \brief Enable garbage collection when passing true and disable otherwise.
   inline void enable_garbage_collection(bool enable);
 
+  /// \brief Registers the calling thread as a thread that accesses terms. The thread
+  ///        that constructs the pool is registered implicitly.
+  inline void register_thread();
+
+  /// \brief Deregisters the calling thread, it should no longer hold any terms.
+  inline void deregister_thread();
+
+  /// \brief Indicates that the calling thread does not access terms until leave_idle()
+  ///        is called, which allows garbage collection to proceed without it.
+  inline void enter_idle();
+
+  /// \brief Indicates that the calling thread accesses terms again, waits for a
+  ///        garbage collection in progress to finish.
+  inline void leave_idle();
+
   /// \brief Creates a integral term with the given value.
   inline aterm create_int(std::size_t val);
 
@@ -117,6 +140,17 @@ public:
   /// \returns The pool of function symbols.
   function_symbol_pool& get_symbol_pool() { return m_function_symbol_pool; }
 private:
+  template<typename T>
+  using thread_safe_type = typename std::conditional<GlobalThreadSafe, std::atomic<T>, T>::type;
+
+  /// \brief Marks and sweeps all storages, assumes that no other thread accesses terms.
+  inline void collect_impl();
+
+  /// \brief Blocks the calling thread when another thread has requested garbage collection.
+  inline void safepoint();
+
+  /// \returns The creation depth of the calling thread.
+  inline std::size_t& creation_depth();
 
   /// Storage for the function symbols.
   function_symbol_pool m_function_symbol_pool;
@@ -140,17 +174,35 @@ private:
   arbitrary_function_application_storage m_appl_dynamic_storage;
 
   /// Track the number of  terms destroyed and reduce the freelist.
-  std::size_t m_countUntilCollection;
+  thread_safe_type<std::size_t> m_countUntilCollection;
 
   /// It can happen that during create_appl with converter the converter generates new terms.
   /// As such these terms might only be protected after the term_appl was actually created.
+  /// When GlobalThreadSafe is enabled a thread local creation depth is used instead.
   std::size_t m_creation_depth = 0;
 
   /// Defer garbage collection until the creation depth is equal to zero again.
-  bool m_deferred_garbage_collection = false;
+  thread_safe_type<bool> m_deferred_garbage_collection{false};
 
   /// Enable automatically triggered garbage collection.
-  bool m_enable_garbage_collection = true;
+  thread_safe_type<bool> m_enable_garbage_collection{true};
+
+  /// The following members are only used when GlobalThreadSafe is enabled.
+
+  /// Protects the number of registered and idle threads.
+  std::mutex m_thread_mutex;
+
+  /// Notified whenever a thread becomes idle and when garbage collection has finished.
+  std::condition_variable m_thread_condition;
+
+  /// The number of threads that access terms, initially only the constructing thread.
+  std::size_t m_registered_threads = 1;
+
+  /// The number of registered threads that are idle or waiting for garbage collection.
+  std::size_t m_idle_threads = 0;
+
+  /// True whenever a thread is (waiting to start) garbage collection.
+  std::atomic<bool> m_collection_requested{false};
 
   /// Represents an empty list.
   aterm m_empty_list;
@@ -157,11 +157,8 @@ void aterm_pool::trigger_collection()
     return;
   }
 
-  if (m_countUntilCollection > 0)
-  {
-    --m_countUntilCollection;
-  }
-  else
+  // The post decrement ensures that only one thread observes that the counter reached zero.
+  if (m_countUntilCollection-- == 0)
   {
     if (m_enable_garbage_collection)
     {
@@ -175,12 +172,47 @@ void aterm_pool::trigger_collection()
 
 void aterm_pool::collect()
 {
-  if (m_creation_depth > 0)
+  if (creation_depth() > 0)
   {
     m_deferred_garbage_collection = true;
     return;
   }
 
+  if (!GlobalThreadSafe)
+  {
+    collect_impl();
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(m_thread_mutex);
+  if (m_collection_requested)
+  {
+    // Another thread is already collecting, so wait for it to finish instead.
+    ++m_idle_threads;
+    m_thread_condition.notify_all();
+    m_thread_condition.wait(lock, [this]() { return !m_collection_requested; });
+    --m_idle_threads;
+    return;
+  }
+
+  // Stop the world, every other registered thread is either idle or waits at a safepoint.
+  m_collection_requested = true;
+  m_thread_condition.wait(lock, [this]() { return m_idle_threads + 1 == m_registered_threads; });
+  lock.unlock();
+
+  // The creation depth prevents the collecting thread from waiting at its own safepoints.
+  ++creation_depth();
+  collect_impl();
+  --creation_depth();
+
+  lock.lock();
+  m_collection_requested = false;
+  lock.unlock();
+  m_thread_condition.notify_all();
+}
+
+void aterm_pool::collect_impl()
+{
   auto timestamp = std::chrono::system_clock::now();
 
   m_deferred_garbage_collection = false;
@@ -236,6 +268,12 @@ void aterm_pool::collect()
   assert(std::get<7>(m_appl_storage).verify_sweep());
   assert(m_appl_dynamic_storage.verify_sweep());
 
+  if (GlobalThreadSafe)
+  {
+    // Function symbols are not removed when their reference count becomes zero in this case.
+    get_symbol_pool().sweep();
+  }
+
   // Print some statistics.
   if (EnableGarbageCollectionMetrics)
   {
@@ -256,19 +294,88 @@ void aterm_pool::enable_garbage_collection(bool enable)
   m_enable_garbage_collection = enable;
 }
 
+void aterm_pool::register_thread()
+{
+  if (GlobalThreadSafe)
+  {
+    // Do not join while the other threads are stopped for garbage collection.
+    std::unique_lock<std::mutex> lock(m_thread_mutex);
+    m_thread_condition.wait(lock, [this]() { return !m_collection_requested; });
+    ++m_registered_threads;
+  }
+}
+
+void aterm_pool::deregister_thread()
+{
+  if (GlobalThreadSafe)
+  {
+    std::unique_lock<std::mutex> lock(m_thread_mutex);
+    assert(m_registered_threads > 1);
+    --m_registered_threads;
+    lock.unlock();
+    m_thread_condition.notify_all();
+  }
+}
+
+void aterm_pool::enter_idle()
+{
+  if (GlobalThreadSafe)
+  {
+    std::unique_lock<std::mutex> lock(m_thread_mutex);
+    ++m_idle_threads;
+    lock.unlock();
+    m_thread_condition.notify_all();
+  }
+}
+
+void aterm_pool::leave_idle()
+{
+  if (GlobalThreadSafe)
+  {
+    std::unique_lock<std::mutex> lock(m_thread_mutex);
+    m_thread_condition.wait(lock, [this]() { return !m_collection_requested; });
+    assert(m_idle_threads > 0);
+    --m_idle_threads;
+  }
+}
+
+void aterm_pool::safepoint()
+{
+  // The arguments of a creation in progress are not protected, so only stop at the outermost creation.
+  if (GlobalThreadSafe && m_collection_requested && creation_depth() == 0)
+  {
+    enter_idle();
+    leave_idle();
+  }
+}
+
+std::size_t& aterm_pool::creation_depth()
+{
+  if (GlobalThreadSafe)
+  {
+    thread_local std::size_t creation_depth = 0;
+    return creation_depth;
+  }
+
+  return m_creation_depth;
+}
+
 aterm aterm_pool::create_int(size_t val)
 {
+  safepoint();
   return m_int_storage.create_int(val);
 }
 
 aterm aterm_pool::create_term(const atermpp::function_symbol& sym)
 {
+  safepoint();
   return std::get<0>(m_appl_storage).create_term(sym);
 }
 
 template<class ...Terms>
 aterm aterm_pool::create_appl(const function_symbol& sym, const Terms&... arguments)
 {
+  safepoint();
   return std::get<sizeof...(Terms)>(m_appl_storage).create_appl(sym, arguments...);
 }
 
@@ -277,6 +384,8 @@ aterm aterm_pool::create_appl_dynamic(const function_symbol& sym,
                             ForwardIterator begin,
                             ForwardIterator end)
 {
+  safepoint();
+
   const std::size_t arity = sym.arity();
 
   switch(arity)
@@ -316,7 +425,8 @@ aterm aterm_pool::create_appl_dynamic(const function_symbol& sym,
                             InputIterator begin,
                             InputIterator end)
 {
-  ++m_creation_depth;
+  safepoint();
+  ++creation_depth();
 
   const std::size_t arity = sym.arity();
   aterm result;
@@ -351,10 +461,10 @@ aterm aterm_pool::create_appl_dynamic(const function_symbol& sym,
     result = m_appl_dynamic_storage.create_appl_dynamic(sym, converter, begin, end);
   }
 
-  --m_creation_depth;
+  --creation_depth();
 
   // Trigger a deferred garbage collection when it was requested and the term has been protected.
-  if (m_creation_depth == 0 && m_deferred_garbage_collection)
+  if (creation_depth() == 0 && m_deferred_garbage_collection)
   {
     if (EnableGarbageCollectionMetrics)
     {
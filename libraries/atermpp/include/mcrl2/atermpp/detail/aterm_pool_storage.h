@@ -19,6 +19,7 @@
 #include "mcrl2/utilities/unordered_set.h"
 
 #include <limits>
+#include <mutex>
 #include <stack>
 #include <utility>
 #include <vector>
@@ -33,7 +34,10 @@ class aterm_pool;
 
 /// \brief This class provides for all types of term storage. It also
 ///       provides garbage collection via its mark and sweep functions.
-/// \details Internally a hash set is used to ensure that the created terms are unique.
+/// \details Internally a hash set is used to ensure that the created terms are unique. When ThreadSafe
+///          is true every storage is protected by its own mutex, which shards the term pool by arity.
+///          The hash set itself is then only accessed under this mutex, or when the pool has stopped
+///          all other threads for garbage collection.
 template<typename Element,
          typename Hash = aterm_hasher<>,
          typename Equals = aterm_equals<>,
@@ -48,8 +52,8 @@ public:
     Equals,
     typename std::conditional<N == DynamicNumberOfArguments,
       atermpp::detail::_aterm_appl_allocator<>,
-      mcrl2::utilities::block_allocator<Element, 1024, ThreadSafe>>::type,
-    ThreadSafe>;
+      mcrl2::utilities::block_allocator<Element, 1024, false>>::type,
+    false>;
   using iterator = typename unordered_set::iterator;
   using const_iterator = typename unordered_set::const_iterator;
 
@@ -170,6 +174,9 @@ private:
   /// This is the set of term pointers to keep the terms unique.
   unordered_set m_term_set;
 
+  /// Protects m_term_set against concurrent modifications, only used when ThreadSafe is true.
+  std::mutex m_mutex;
+
   /// This array stores creation, resp deletion, hooks for function symbols.
   std::vector<callback_pair> m_creation_hooks;
   std::vector<callback_pair> m_deletion_hooks;
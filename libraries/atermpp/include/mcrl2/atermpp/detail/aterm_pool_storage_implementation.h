@@ -288,9 +288,15 @@ ATERM_POOL_STORAGE_TEMPLATES
 template<typename ...Args>
 aterm ATERM_POOL_STORAGE::emplace(Args&&... args)
 {
+  std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+  if (ThreadSafe) { lock.lock(); }
 
   auto result = m_term_set.emplace(std::forward<Args>(args)...);
   aterm term(&(*result.first));
+
+  // The hooks and garbage collection might create terms themselves, so release the lock first.
+  if (ThreadSafe) { lock.unlock(); }
+
   if (result.second)
   {
     // A new term was created
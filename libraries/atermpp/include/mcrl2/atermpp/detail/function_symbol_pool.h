@@ -20,6 +20,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace atermpp
@@ -48,8 +49,13 @@ public:
   function_symbol create(const std::string& name, const std::size_t arity, const bool check_for_registered_functions = false);
 
   /// \brief Frees the memory used by the passed element and remove it from the set.
+  /// \details When GlobalThreadSafe is enabled this is deferred to sweep().
   void destroy(_function_symbol* f);
 
+  /// \brief Removes all function symbols that are no longer referenced.
+  /// \details Should only be called when no other thread can access function symbols.
+  void sweep();
+
   /// \brief Restore the index back to index before registering this prefix.
   void deregister(const std::string& prefix);
 
@@ -82,12 +88,18 @@ private:
     _function_symbol,
     function_symbol_hasher,
     function_symbol_equals,
-    mcrl2::utilities::block_allocator<_function_symbol, 1024, GlobalThreadSafe>,
-    GlobalThreadSafe>;
+    mcrl2::utilities::block_allocator<_function_symbol, 1024, false>,
+    false>;
+
+  /// \brief Implementation of get_sufficiently_large_postfix_index without locking.
+  std::size_t get_sufficiently_large_postfix_index_impl(const std::string& prefix) const;
 
   /// \brief Stores the underlying function symbols.
   unordered_set m_symbol_set;
 
+  /// \brief Protects all members of this pool when GlobalThreadSafe is enabled.
+  mutable std::mutex m_mutex;
+
   /// \brief A map that records a function for each prefix that must be called to set the
   ///        postfix number to a sufficiently high number if a function symbol with the same
   ///        prefix string is registered.
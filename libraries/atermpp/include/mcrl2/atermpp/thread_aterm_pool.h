@@ -0,0 +1,55 @@
+// Author(s): Maurice Laveaux.
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef MCRL2_ATERMPP_THREAD_ATERM_POOL_H
+#define MCRL2_ATERMPP_THREAD_ATERM_POOL_H
+
+#include "mcrl2/atermpp/detail/global_aterm_pool.h"
+
+namespace atermpp
+{
+
+/// \brief Registers the calling thread with the global term pool for the lifetime of this object.
+/// \details Must be constructed before, and hence destroyed after, any term that is used by
+///          a thread other than the main thread. Has no effect unless GlobalThreadSafe is enabled.
+class thread_aterm_pool_registration : private mcrl2::utilities::noncopyable
+{
+public:
+  thread_aterm_pool_registration()
+  {
+    detail::g_term_pool().register_thread();
+  }
+
+  ~thread_aterm_pool_registration()
+  {
+    detail::g_term_pool().deregister_thread();
+  }
+};
+
+/// \brief Indicates that a registered thread does not access terms for the lifetime of this object.
+/// \details Should be used whenever a registered thread blocks on another thread, for example
+///          when joining threads or waiting for work. Otherwise garbage collection triggered by
+///          the other thread cannot proceed. Has no effect unless GlobalThreadSafe is enabled.
+class thread_aterm_pool_idle : private mcrl2::utilities::noncopyable
+{
+public:
+  thread_aterm_pool_idle()
+  {
+    detail::g_term_pool().enter_idle();
+  }
+
+  ~thread_aterm_pool_idle()
+  {
+    detail::g_term_pool().leave_idle();
+  }
+};
+
+} // namespace atermpp
+
+#endif // MCRL2_ATERMPP_THREAD_ATERM_POOL_H
@@ -44,6 +44,19 @@ static constexpr std::uint16_t BAF_MAGIC = 0x8baf;
 /// 19 Juli 2019      : version changed to 0x8305 (introduction of the streamable aterm format)
 static constexpr std::uint16_t BAF_VERSION = 0x8305;
 
+/// \brief The version number of the windowed binary aterm format, which is only written on request.
+/// \details History:
+///
+/// 17 October 2026   : version 0x8306 (introduction of blocks that do not share terms, and an index of the blocks)
+static constexpr std::uint16_t BAF_WINDOWED_VERSION = 0x8306;
+
+/// \brief In the windowed format a term with function symbol index zero is followed by one of these markers.
+enum class stream_marker
+{
+  end_of_stream = 0,
+  end_of_block
+};
+
 /// \brief Each packet has a header consisting of a type and an invisible bit (indicating no output).
 enum class packet_type
 {
@@ -56,17 +69,23 @@ enum class packet_type
 /// \brief The number of bits needed to store an element of packet_type.
 static constexpr unsigned int packet_bits = 2;
 
-binary_aterm_output::binary_aterm_output(std::ostream& stream)
-  : m_stream(stream)
+binary_aterm_output::binary_aterm_output(std::ostream& stream, std::size_t block_size)
+  : m_stream(stream),
+    m_block_size(block_size)
 {
-  // The term with function symbol index 0 indicates the end of the stream, its actual value does not matter.
-  m_function_symbols.insert(detail::g_as_int);
-  m_function_symbol_index_width = 1;
+  clear_indices();
 
   // Write the header of the binary aterm format.
   m_stream.write_bits(0, 8);
   m_stream.write_bits(BAF_MAGIC, 16);
-  m_stream.write_bits(BAF_VERSION, 16);
+  m_stream.write_bits(m_block_size == 0 ? BAF_VERSION : BAF_WINDOWED_VERSION, 16);
+
+  if (m_block_size != 0)
+  {
+    // The first block starts directly after the header.
+    m_stream.align();
+    m_block_positions.push_back(m_stream.position());
+  }
 }
 
 binary_aterm_output::~binary_aterm_output()
@@ -74,6 +93,45 @@ binary_aterm_output::~binary_aterm_output()
   // Write the end of the stream.
   m_stream.write_bits(static_cast<std::size_t>(packet_type::aterm), packet_bits);
   m_stream.write_integer(0);
+
+  if (m_block_size != 0)
+  {
+    m_stream.write_integer(static_cast<std::size_t>(stream_marker::end_of_stream));
+
+    // Write the index of the blocks, followed by its position in the last 64 bits of the stream.
+    m_stream.align();
+    std::size_t index_position = m_stream.position();
+    m_stream.write_integer(m_block_positions.size());
+    for (std::size_t position : m_block_positions)
+    {
+      m_stream.write_integer(position);
+    }
+    m_stream.align();
+    m_stream.write_bits(index_position >> 32, 32);
+    m_stream.write_bits(index_position & 0xffffffff, 32);
+  }
+}
+
+void binary_aterm_output::clear_indices()
+{
+  m_terms.clear();
+  m_function_symbols.clear();
+
+  // The term with function symbol index 0 indicates the end of the stream, its actual value does not matter.
+  m_function_symbols.insert(detail::g_as_int);
+  m_function_symbol_index_width = 1;
+}
+
+void binary_aterm_output::start_block()
+{
+  // Mark the end of the block, the next block starts at the next byte position.
+  m_stream.write_bits(static_cast<std::size_t>(packet_type::aterm), packet_bits);
+  m_stream.write_bits(0, function_symbol_index_width());
+  m_stream.write_integer(static_cast<std::size_t>(stream_marker::end_of_block));
+  m_stream.align();
+  m_block_positions.push_back(m_stream.position());
+
+  clear_indices();
 }
 
 /// \brief Keep track of the remaining arguments that still has to be processed for this term.
@@ -91,6 +149,12 @@ void binary_aterm_output::write_term(const aterm& term)
 {
   assert(!term.type_is_int());
 
+  if (m_block_size != 0 && m_terms.size() >= m_block_size)
+  {
+    // The current block is full, so this term is written in a new block.
+    start_block();
+  }
+
   // Traverse the term bottom up and store the subterms (and function symbol) before the actual term.
   std::stack<write_todo> stack;
   stack.emplace(static_cast<const aterm_appl&>(term));
@@ -162,11 +226,11 @@ unsigned int binary_aterm_output::function_symbol_index_width()
 }
 
 binary_aterm_input::binary_aterm_input(std::istream& is)
-  : m_stream(is)
+  : m_input(is),
+    m_start(is.tellg()),
+    m_stream(is)
 {
-  // The term with function symbol index 0 indicates the end of the stream.
-  m_function_symbols.emplace_back();
-  m_function_symbol_index_width = 1;
+  clear_indices();
 
   // Read the binary aterm format header.
   if (m_stream.read_bits(8) != 0 || m_stream.read_bits(16) != BAF_MAGIC)
@@ -175,11 +239,87 @@ binary_aterm_input::binary_aterm_input(std::istream& is)
   }
 
   std::size_t version = m_stream.read_bits(16);
-  if (version != BAF_VERSION)
+  if (version != BAF_VERSION && version != BAF_WINDOWED_VERSION)
   {
     throw mcrl2::runtime_error("The BAF version (" + std::to_string(version) + ") of the input file is incompatible with the version (" + std::to_string(BAF_VERSION) +
                                ") of this tool. The input file must be regenerated. ");
   }
+
+  m_windowed = version == BAF_WINDOWED_VERSION;
+  if (m_windowed)
+  {
+    m_stream.align();
+  }
+}
+
+void binary_aterm_input::clear_indices()
+{
+  m_terms.clear();
+  m_function_symbols.clear();
+
+  // The term with function symbol index 0 indicates the end of the stream.
+  m_function_symbols.emplace_back();
+  m_function_symbol_index_width = 1;
+}
+
+void binary_aterm_input::read_block_positions()
+{
+  if (!m_block_positions.empty())
+  {
+    return;
+  }
+
+  // The index is read with a separate bitstream, such that the bits buffered in m_stream remain valid.
+  std::istream::pos_type position = m_input.tellg();
+
+  // The last 64 bits of the stream contain the position of the index.
+  m_input.seekg(-8, std::ios_base::end);
+  ibitstream trailer(m_input);
+  std::size_t index_position = trailer.read_bits(32) << 32;
+  index_position |= trailer.read_bits(32);
+
+  m_input.seekg(m_start + static_cast<std::istream::off_type>(index_position));
+  ibitstream index(m_input);
+  std::size_t number_of_blocks = index.read_integer();
+  for (std::size_t i = 0; i < number_of_blocks; ++i)
+  {
+    m_block_positions.push_back(index.read_integer());
+  }
+
+  m_input.seekg(position);
+  if (m_input.fail() || m_block_positions.empty())
+  {
+    throw mcrl2::runtime_error("Failed to read the index of the blocks of the binary aterm stream.");
+  }
+}
+
+std::size_t binary_aterm_input::number_of_blocks()
+{
+  if (!m_windowed)
+  {
+    return 1;
+  }
+
+  read_block_positions();
+  return m_block_positions.size();
+}
+
+void binary_aterm_input::seek_block(std::size_t block)
+{
+  if (!m_windowed)
+  {
+    throw mcrl2::runtime_error("Can only seek to a block in a binary aterm stream in the windowed format.");
+  }
+
+  read_block_positions();
+  if (block >= m_block_positions.size())
+  {
+    throw mcrl2::runtime_error("The binary aterm stream does not contain block " + std::to_string(block) + ".");
+  }
+
+  m_input.seekg(m_start + static_cast<std::istream::off_type>(m_block_positions[block]));
+  m_stream.reset();
+  clear_indices();
 }
 
 std::size_t binary_aterm_output::write_function_symbol(const function_symbol& symbol)
@@ -226,6 +366,14 @@ aterm binary_aterm_input::read_term()
 
       if (!symbol.defined())
       {
+        if (m_windowed && static_cast<stream_marker>(m_stream.read_integer()) == stream_marker::end_of_block)
+        {
+          // The next block starts at the next byte position and shares no terms with the previous ones.
+          m_stream.align();
+          clear_indices();
+          continue;
+        }
+
         // The term with function symbol zero marks the end of the stream.
         return aterm();
       }
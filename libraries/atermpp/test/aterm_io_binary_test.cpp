@@ -88,3 +88,59 @@ BOOST_AUTO_TEST_CASE(transitions_test)
     BOOST_CHECK_EQUAL(output.read_term(), sequence[index]);
   }
 }
+
+BOOST_AUTO_TEST_CASE(windowed_format_test)
+{
+  std::vector<aterm_appl> sequence;
+
+  function_symbol transition("transition", 3);
+  function_symbol state("state", 1);
+  for (std::size_t index = 0; index < 100; ++index)
+  {
+    sequence.emplace_back(transition, aterm_appl(state, aterm_int(index % 7)), aterm_int(index % 5), aterm_appl(state, aterm_int(index % 11)));
+  }
+
+  std::stringstream stream;
+  {
+    // Every term contains at least four shared subterms, so every block contains at most two terms.
+    binary_aterm_output output(stream, 5);
+
+    for (const auto& term : sequence)
+    {
+      output.write_term(term);
+    }
+  }
+
+  {
+    binary_aterm_input input(stream);
+
+    for (std::size_t index = 0; index < sequence.size(); ++index)
+    {
+      BOOST_CHECK_EQUAL(input.read_term(), sequence[index]);
+    }
+    BOOST_CHECK(!input.read_term().defined());
+  }
+
+  // Reading can continue at every block.
+  stream.clear();
+  stream.seekg(0);
+  binary_aterm_input input(stream);
+  std::size_t number_of_blocks = input.number_of_blocks();
+  BOOST_CHECK(number_of_blocks >= sequence.size() / 2);
+
+  std::size_t index = 0;
+  for (std::size_t block = 0; block < number_of_blocks; ++block)
+  {
+    input.seek_block(block);
+    aterm term = input.read_term();
+    while (term.defined() && term != sequence[index])
+    {
+      ++index;
+    }
+    BOOST_CHECK(index < sequence.size());
+  }
+
+  input.seek_block(number_of_blocks - 1);
+  BOOST_CHECK_EQUAL(input.read_term(), sequence.back());
+  BOOST_CHECK(!input.read_term().defined());
+}
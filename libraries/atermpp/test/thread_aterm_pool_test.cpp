@@ -0,0 +1,94 @@
+// Author(s): Maurice Laveaux
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file thread_aterm_pool_test.cpp
+/// \brief Test the creation and garbage collection of terms by multiple threads.
+
+#define BOOST_TEST_MODULE thread_aterm_pool_test
+#include <boost/test/included/unit_test_framework.hpp>
+
+#include "mcrl2/atermpp/aterm_appl.h"
+#include "mcrl2/atermpp/aterm_int.h"
+#include "mcrl2/atermpp/aterm_list.h"
+#include "mcrl2/atermpp/thread_aterm_pool.h"
+
+#include <thread>
+#include <vector>
+
+using namespace atermpp;
+
+/// \brief Creates the list [f(0), ..., f(n-1)] and checks its contents.
+static bool create_and_check_list(std::size_t n)
+{
+  function_symbol f("f", 1);
+
+  aterm_list list;
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    list.push_front(aterm_appl(f, aterm_int(n - i - 1)));
+  }
+
+  std::size_t i = 0;
+  for (const aterm& t : list)
+  {
+    const aterm_appl& appl = down_cast<aterm_appl>(t);
+    if (appl.function() != f || down_cast<aterm_int>(appl[0]).value() != i)
+    {
+      return false;
+    }
+    ++i;
+  }
+  return i == n;
+}
+
+BOOST_AUTO_TEST_CASE(test_concurrent_creation)
+{
+  // Without a thread safe term library only the main thread can be used.
+  const std::size_t number_of_threads = detail::GlobalThreadSafe ? 4 : 1;
+  std::vector<char> results(number_of_threads, false);
+
+  auto work = [&results](std::size_t index)
+    {
+      bool result = true;
+      for (std::size_t i = 0; i < 20; ++i)
+      {
+        result = result && create_and_check_list(10000);
+        if (i % 5 == 0)
+        {
+          // Explicitly trigger garbage collection, which waits for all other threads.
+          detail::g_term_pool().collect();
+        }
+      }
+      results[index] = result;
+    };
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < number_of_threads; ++i)
+  {
+    threads.emplace_back([&work, i]()
+      {
+        thread_aterm_pool_registration registration;
+        work(i);
+      });
+  }
+
+  work(0);
+
+  {
+    thread_aterm_pool_idle idle;
+    for (std::thread& thread : threads)
+    {
+      thread.join();
+    }
+  }
+
+  for (char result : results)
+  {
+    BOOST_CHECK(result);
+  }
+}
@@ -14,12 +14,14 @@
 #define MCRL2_CORE_INDEX_TRAITS_H
 
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <stack>
 #include <unordered_map>
 #include <stdexcept>
 #include "mcrl2/utilities/hash_utility.h"
 #include "mcrl2/atermpp/aterm_int.h"
+#include "mcrl2/atermpp/detail/aterm_configuration.h"
 #include "mcrl2/core/identifier_string.h"
 
 namespace mcrl2 {
@@ -47,6 +49,14 @@ std::size_t& variable_map_max_index()
   return s;
 }
 
+/// \brief Protects the variable index map when the term library is thread safe.
+template <typename Variable, typename KeyType>
+std::mutex& variable_map_mutex()
+{
+  static std::mutex m;
+  return m;
+}
+
 /// \brief For several variable types in mCRL2 an implicit mapping of these variables
 /// to integers is available. This is done for efficiency reasons. Examples are:
 ///
@@ -79,6 +89,8 @@ struct index_traits
   static inline
   std::size_t insert(const KeyType& x)
   {
+    std::unique_lock<std::mutex> lock(variable_map_mutex<Variable, KeyType>(), std::defer_lock);
+    if (atermpp::detail::GlobalThreadSafe) { lock.lock(); }
     auto& m = variable_index_map<Variable, KeyType>();
     auto i = m.find(x);
     if (i == m.end())
@@ -106,6 +118,8 @@ struct index_traits
   static inline
   void erase(const KeyType& x)
   {
+    std::unique_lock<std::mutex> lock(variable_map_mutex<Variable, KeyType>(), std::defer_lock);
+    if (atermpp::detail::GlobalThreadSafe) { lock.lock(); }
     auto& m = variable_index_map<Variable, KeyType>();
     auto& s = variable_map_free_numbers<Variable, KeyType>();
     auto i = m.find(x);
@@ -119,6 +133,8 @@ struct index_traits
   static inline
   std::size_t size()
   {
+    std::unique_lock<std::mutex> lock(variable_map_mutex<Variable, KeyType>(), std::defer_lock);
+    if (atermpp::detail::GlobalThreadSafe) { lock.lock(); }
     auto& m = variable_index_map<Variable, KeyType>();
     return m.size();
   }
@@ -10,8 +10,10 @@
 #ifndef MCRL2_DATA_DETAIL_REWRITE_JITTY_H
 #define MCRL2_DATA_DETAIL_REWRITE_JITTY_H
 
+#include <set>
 #include "mcrl2/data/detail/rewrite.h"
 #include "mcrl2/data/data_specification.h"
+#include "mcrl2/data/detail/rewrite/jitty_memo_cache.h"
 #include "mcrl2/data/detail/rewrite/strategy_rule.h"
 
 namespace mcrl2
@@ -35,10 +37,30 @@ class RewriterJitty: public Rewriter
 
     RewriterJitty& operator=(const RewriterJitty& other)=delete;
 
+    /// \brief Caches the normal forms of closed terms with a head symbol in memoised_symbols.
+    /// \details At most max_size normal forms are kept; the policy determines which normal form is removed
+    ///          when the cache is full. If memoised_symbols is empty, user defined mappings with a recursive
+    ///          rewrite rule are memoised. A max_size of zero disables the cache. The cache is also enabled when
+    ///          the environment variable MCRL2_JITTYCACHE contains a maximum size. The policy and the names of the
+    ///          memoised symbols can then be set using MCRL2_JITTYCACHEPOLICY (fifo or clock) and a comma
+    ///          separated list in MCRL2_JITTYCACHESYMBOLS.
+    void enable_memo_cache(std::size_t max_size,
+                           memo_cache_policy policy = memo_cache_policy::clock,
+                           const std::set<function_symbol>& memoised_symbols = std::set<function_symbol>());
+
+    /// \brief The normal form cache, or nullptr if it is not enabled.
+    const jitty_memo_cache* get_memo_cache() const
+    {
+      return m_memo_cache.get();
+    }
+
   private:
     std::map< function_symbol, data_equation_list > jitty_eqns;
     std::vector<strategy> jitty_strat;
 
+    std::unique_ptr<jitty_memo_cache> m_memo_cache;
+    std::vector<bool> m_memoised; // Indexed by the index of function symbols.
+
     data_expression rewrite_aux(const data_expression& term, substitution_type& sigma);
 
     data_expression rewrite_aux_function_symbol(
@@ -46,6 +68,13 @@ class RewriterJitty: public Rewriter
                       const data_expression& term,
                       substitution_type& sigma);
 
+    data_expression rewrite_aux_function_symbol_without_cache(
+                      const function_symbol& op,
+                      const data_expression& term,
+                      substitution_type& sigma);
+
+    void enable_memo_cache_from_environment();
+
     data_expression rewrite_aux_const_function_symbol(
                       const function_symbol& op,
                       substitution_type& sigma);
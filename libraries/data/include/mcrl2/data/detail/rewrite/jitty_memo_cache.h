@@ -0,0 +1,121 @@
+// Author(s): Jan Friso Groote
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/data/detail/rewrite/jitty_memo_cache.h
+/// \brief A bounded cache from closed terms to their normal forms.
+
+#ifndef MCRL2_DATA_DETAIL_REWRITE_JITTY_MEMO_CACHE_H
+#define MCRL2_DATA_DETAIL_REWRITE_JITTY_MEMO_CACHE_H
+
+#include <memory>
+#include <string>
+#include "mcrl2/data/data_expression.h"
+#include "mcrl2/utilities/exception.h"
+#include "mcrl2/utilities/fixed_size_cache.h"
+
+namespace mcrl2
+{
+namespace data
+{
+namespace detail
+{
+
+/// \brief The policy that determines which normal form is removed from a full cache.
+enum class memo_cache_policy
+{
+  fifo,  ///< Remove the normal form that was inserted first.
+  clock  ///< Remove a normal form that has not been used since the clock hand passed it.
+};
+
+inline
+memo_cache_policy parse_memo_cache_policy(const std::string& s)
+{
+  if (s == "fifo")
+  {
+    return memo_cache_policy::fifo;
+  }
+  if (s == "clock")
+  {
+    return memo_cache_policy::clock;
+  }
+  throw mcrl2::runtime_error("Unknown memo cache policy " + s + "; expected fifo or clock.");
+}
+
+/// \brief A cache from closed terms to their normal forms, with a maximum number of entries.
+/// \details The number of successful and unsuccessful lookups is recorded to report the hit rate.
+class jitty_memo_cache
+{
+  protected:
+    std::size_t m_hits = 0;
+    std::size_t m_misses = 0;
+
+  public:
+    virtual ~jitty_memo_cache() = default;
+
+    /// \brief Returns the cached normal form of t, or nullptr if t is not in the cache.
+    /// \details The returned pointer is invalidated by the next call to insert.
+    virtual const data_expression* find(const data_expression& t) = 0;
+
+    /// \brief Stores that normal_form is the normal form of t.
+    virtual void insert(const data_expression& t, const data_expression& normal_form) = 0;
+
+    std::size_t hits() const
+    {
+      return m_hits;
+    }
+
+    std::size_t misses() const
+    {
+      return m_misses;
+    }
+};
+
+template <typename Cache>
+class jitty_memo_cache_implementation: public jitty_memo_cache
+{
+  protected:
+    Cache m_cache;
+
+  public:
+    explicit jitty_memo_cache_implementation(std::size_t max_size)
+      : m_cache(max_size)
+    {}
+
+    const data_expression* find(const data_expression& t) override
+    {
+      auto i = m_cache.find(t);
+      if (i == m_cache.end())
+      {
+        m_misses++;
+        return nullptr;
+      }
+      m_hits++;
+      return &i->second;
+    }
+
+    void insert(const data_expression& t, const data_expression& normal_form) override
+    {
+      m_cache.emplace(t, normal_form);
+    }
+};
+
+inline
+std::unique_ptr<jitty_memo_cache> make_jitty_memo_cache(std::size_t max_size, memo_cache_policy policy)
+{
+  if (policy == memo_cache_policy::fifo)
+  {
+    return std::unique_ptr<jitty_memo_cache>(new jitty_memo_cache_implementation<utilities::fifo_cache<data_expression, data_expression> >(max_size));
+  }
+  return std::unique_ptr<jitty_memo_cache>(new jitty_memo_cache_implementation<utilities::clock_cache<data_expression, data_expression> >(max_size));
+}
+
+} // namespace detail
+} // namespace data
+} // namespace mcrl2
+
+#endif // MCRL2_DATA_DETAIL_REWRITE_JITTY_MEMO_CACHE_H
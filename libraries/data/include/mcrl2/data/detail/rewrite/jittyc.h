@@ -21,8 +21,12 @@
 
 #ifdef MCRL2_JITTYC_AVAILABLE
 
+#include <atomic>
+#include <map>
 #include <utility>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace mcrl2
 {
@@ -37,13 +41,15 @@ typedef std::vector < sort_expression_list> sort_list_vector;
 /// \brief The normal_form_cache class stores normal forms of data_expressions that
 ///        are inserted in it. By keeping the cache on the stack, the normal forms
 ///        in it will not be freed by the ATerm library, and can therefore be used
-///        in the generated jittyc code.
+///        in the generated jittyc code. The generated code refers to a stored term
+///        by its index, such that it does not depend on the addresses of terms.
 ///
 class normal_form_cache
 {
   private:
     RewriterJitty& m_rewriter;
-    std::set<data_expression> m_lookup;
+    std::vector<data_expression> m_terms;
+    std::map<data_expression, std::size_t> m_lookup;
   public:
     normal_form_cache(RewriterJitty& rewriter)
       : m_rewriter(rewriter)
@@ -60,19 +66,64 @@ class normal_form_cache
   ///
   std::string insert(const data_expression& t)
   {
-    std::stringstream ss;
     RewriterJitty::substitution_type sigma;
-    auto pair = m_lookup.insert(m_rewriter(t, sigma));
-    ss << "*reinterpret_cast<const data_expression*>(" << (void*)&(*pair.first) << ")";
+    return insert_term(m_rewriter(t, sigma));
+  }
+
+  ///
+  /// \brief insert_term stores t in the cache without rewriting it, and returns a string
+  ///        that is a C++ representation of t, like insert.
+  /// \param t The term to store.
+  /// \return A C++ string that evaluates to t.
+  ///
+  std::string insert_term(const data_expression& t)
+  {
+    auto pair = m_lookup.insert(std::make_pair(t, m_terms.size()));
+    if (pair.second)
+    {
+      m_terms.push_back(t);
+    }
+    std::stringstream ss;
+    ss << "this_rewriter->cached_term_get(" << pair.first->second << ")";
     return ss.str();
   }
 
+  ///
+  /// \brief get returns the term with the given index.
+  ///
+  const data_expression& get(std::size_t i) const
+  {
+    assert(i < m_terms.size());
+    return m_terms[i];
+  }
+
+  ///
+  /// \brief terms returns the terms in the cache, ordered by their index.
+  ///
+  const std::vector<data_expression>& terms() const
+  {
+    return m_terms;
+  }
+
+  ///
+  /// \brief set_terms replaces the contents of the cache by the given terms. 
+  ///
+  void set_terms(const std::vector<data_expression>& terms)
+  {
+    clear();
+    for (const data_expression& t: terms)
+    {
+      insert_term(t);
+    }
+  }
+
   ///
   /// \brief clear clears the cache. This operation invalidates all the C++ strings
   ///        obtained via the insert() method.
   ///
   void clear()
   {
+    m_terms.clear();
     m_lookup.clear();
   }
 };
@@ -124,6 +175,18 @@ class RewriterCompilingJitty: public Rewriter
       return (rewriter_bound_variables[i]);
     }
 
+    // The terms that are used by the generated code, such as function symbols and
+    // normal forms, are stored in m_nf_cache and are obtained using their index.
+    const data_expression& cached_term_get(const std::size_t i) const
+    {
+      return m_nf_cache.get(i);
+    }
+
+    // Restores the tables above, and the terms in m_nf_cache, from a string that was
+    // created by generated_code_data. This is done by the generated code when it is loaded,
+    // which makes it possible to load code that was generated by another process.
+    void load_generated_code_data(const std::string& data);
+
     // The two arrays below are intended to contain the precompiled functions used
     // for rewriting. They are used to find the relevant compiled rewriting code quickly. 
     std::vector<rewriter_function> functions_when_arguments_are_not_in_normal_form;
@@ -145,6 +208,13 @@ class RewriterCompilingJitty: public Rewriter
     std::shared_ptr<uncompiled_library> rewriter_so;
     normal_form_cache m_nf_cache;
 
+    // A fully optimised rewriter that is compiled in the background while a quickly compiled
+    // rewriter is used. It replaces rewriter_so once m_optimised_rewriter_ready is set.
+    std::shared_ptr<uncompiled_library> m_optimised_rewriter_so;
+    std::thread m_optimised_rewriter_thread;
+    std::atomic<bool> m_optimised_rewriter_ready;
+    std::string m_optimised_rewriter_error;
+
     void (*so_rewr_cleanup)();
     data_expression(*so_rewr)(const data_expression&, RewriterCompilingJitty*);
 
@@ -155,7 +225,12 @@ class RewriterCompilingJitty: public Rewriter
     bool calc_nfs(const data_expression& t, variable_or_number_list nnfvars);
     void CleanupRewriteSystem();
     void BuildRewriteSystem();
-    void generate_code(const std::string& filename);
+    void load_rewriter_library();
+    void load_optimised_rewriter();
+    void join_optimised_rewriter_thread();
+    std::vector<std::string> generate_code(std::size_t number_of_parts);
+    std::string generated_code_data() const;
+    std::string compile_cache_key() const;
     void generate_rewr_functions(std::ostream& s, const data::function_symbol& func, const data_equation_list& eqs);
     bool lift_rewrite_rule_to_right_arity(data_equation& e, const std::size_t requested_arity);
     sort_list_vector get_residual_sorts(const sort_expression& s, const std::size_t actual_arity, const std::size_t requested_arity);
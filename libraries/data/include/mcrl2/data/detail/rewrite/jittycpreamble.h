@@ -23,15 +23,20 @@ using atermpp::down_cast;
 //
 // Declaration of rewriter library interface
 //
+// The generated code can be split over several translation units. Only the first one defines
+// the interface of the library. The other ones define MCRL2_JITTYC_PART.
+//
 #ifdef _MSC_VER
 #define DLLEXPORT __declspec(dllexport)
 #else
 #define DLLEXPORT
 #endif // _MSC_VER
 
+#ifndef MCRL2_JITTYC_PART
 extern "C" {
   DLLEXPORT bool init(rewriter_interface* i, RewriterCompilingJitty* this_rewriter);
 }
+#endif // MCRL2_JITTYC_PART
 
 // A rewrite_term is a term that may or may not be in normal form. If the method"
 // normal_form is invoked, it will calculate a normal form for itself as efficiently as possible."
@@ -49,7 +54,9 @@ static const data_expression& local_rewrite(const data_expression& t)
 //
 // Forward declarations
 //
+#ifndef MCRL2_JITTYC_PART
 static void set_the_precompiled_rewrite_functions_in_a_lookup_table(RewriterCompilingJitty* this_rewriter);
+#endif // MCRL2_JITTYC_PART
 static data_expression rewrite_aux(const data_expression& t, const bool arguments_in_normal_form, RewriterCompilingJitty* this_rewriter);
 static inline data_expression rewrite_abstraction_aux(const abstraction& a, const data_expression& t, RewriterCompilingJitty* this_rewriter);
 static data_expression rewrite_with_arguments_in_normal_form(const data_expression& t, RewriterCompilingJitty* this_rewriter)
@@ -333,6 +340,8 @@ data_expression rewrite_aux(const data_expression& t, const bool arguments_in_no
   }
 }
 
+#ifndef MCRL2_JITTYC_PART
+
 static
 void rewrite_cleanup()
 {
@@ -355,4 +364,6 @@ bool init(rewriter_interface* i, RewriterCompilingJitty* this_rewriter)
   return true;
 }
 
+#endif // MCRL2_JITTYC_PART
+
 #endif // __REWR_JITTYC_PREAMBLE_H
@@ -54,6 +54,15 @@ void increment_rewrite_count()
   }
 }
 
+/// \brief Displays the number of lookups in the memo cache of a rewriter, and how many of them succeeded.
+inline
+void display_memo_cache_statistics(std::size_t hits, std::size_t misses)
+{
+  std::size_t lookups = hits + misses;
+  mCRL2log(log::verbose) << "memo cache: lookups = " << lookups << ", hits = " << hits
+                         << ", hit rate = " << (lookups == 0 ? 0.0 : (100.0 * hits) / lookups) << "%" << std::endl;
+}
+
 } // namespace detail
 
 } // namespace data
@@ -23,12 +23,11 @@
 #include "mcrl2/utilities/detail/memory_utility.h"
 #include "mcrl2/utilities/exception.h"
 #include "mcrl2/core/detail/function_symbols.h"
+#include "mcrl2/utilities/text_utility.h"
 #include "mcrl2/data/substitutions/mutable_map_substitution.h"
+#include "mcrl2/data/find.h"
 #include "mcrl2/data/replace.h"
-
-#ifdef MCRL2_DISPLAY_REWRITE_STATISTICS
 #include "mcrl2/data/detail/rewrite_statistics.h"
-#endif
 
 using namespace mcrl2::log;
 using namespace mcrl2::core;
@@ -200,10 +199,97 @@ RewriterJitty::RewriterJitty(
   }
 
   rebuild_strategy();
+  enable_memo_cache_from_environment();
 }
 
 RewriterJitty::~RewriterJitty()
 {
+  if (m_memo_cache && m_memo_cache->hits() + m_memo_cache->misses() > 0)
+  {
+    display_memo_cache_statistics(m_memo_cache->hits(), m_memo_cache->misses());
+  }
+}
+
+// A function symbol is considered expensive if it is a user defined mapping with a rewrite rule that
+// refers to the function symbol itself. Repeatedly normalising such a symbol applied to the same
+// arguments is the typical case in which a normal form cache pays off.
+static bool is_expensive_function_symbol(const function_symbol& f, const data_equation_list& equations)
+{
+  for (const data_equation& eq: equations)
+  {
+    if (find_function_symbols(eq.rhs()).count(f) > 0 || find_function_symbols(eq.condition()).count(f) > 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void RewriterJitty::enable_memo_cache(
+                      std::size_t max_size,
+                      memo_cache_policy policy,
+                      const std::set<function_symbol>& memoised_symbols)
+{
+  m_memoised.clear();
+  m_memo_cache.reset();
+  if (max_size == 0)
+  {
+    return;
+  }
+
+  const function_symbol_vector& mappings = m_data_specification_for_enumeration.user_defined_mappings();
+  for (const std::pair<const function_symbol, data_equation_list>& p: jitty_eqns)
+  {
+    const function_symbol& f = p.first;
+    if (memoised_symbols.empty() ?
+          std::find(mappings.begin(), mappings.end(), f) != mappings.end() && is_expensive_function_symbol(f, p.second) :
+          memoised_symbols.count(f) > 0)
+    {
+      const std::size_t i = core::index_traits<data::function_symbol, function_symbol_key_type, 2>::index(f);
+      if (i >= m_memoised.size())
+      {
+        m_memoised.resize(i + 1, false);
+      }
+      m_memoised[i] = true;
+      mCRL2log(debug) << "The normal forms of " << f << " are cached." << std::endl;
+    }
+  }
+  m_memo_cache = make_jitty_memo_cache(max_size, policy);
+}
+
+void RewriterJitty::enable_memo_cache_from_environment()
+{
+  const char* env_size = std::getenv("MCRL2_JITTYCACHE");
+  if (env_size == nullptr)
+  {
+    return;
+  }
+  const long max_size = std::atol(env_size);
+
+  memo_cache_policy policy = memo_cache_policy::clock;
+  const char* env_policy = std::getenv("MCRL2_JITTYCACHEPOLICY");
+  if (env_policy)
+  {
+    policy = parse_memo_cache_policy(env_policy);
+  }
+
+  std::set<function_symbol> memoised_symbols;
+  const char* env_symbols = std::getenv("MCRL2_JITTYCACHESYMBOLS");
+  if (env_symbols)
+  {
+    for (const std::string& name: utilities::split(env_symbols, ","))
+    {
+      const std::string s = utilities::trim_copy(name);
+      for (const std::pair<const function_symbol, data_equation_list>& p: jitty_eqns)
+      {
+        if (std::string(p.first.name()) == s)
+        {
+          memoised_symbols.insert(p.first);
+        }
+      }
+    }
+  }
+  enable_memo_cache(max_size > 0 ? static_cast<std::size_t>(max_size) : 0, policy, memoised_symbols);
 }
 
 static data_expression subst_values(
@@ -467,10 +553,60 @@ data_expression RewriterJitty::rewrite_aux(
   }
 }
 
+// Returns true if t contains no variables. Terms with binders or where clauses are not considered.
+static bool is_closed_term(const data_expression& t)
+{
+  if (is_function_symbol(t))
+  {
+    return true;
+  }
+  if (is_application(t))
+  {
+    const application& ta = atermpp::down_cast<application>(t);
+    if (!is_closed_term(ta.head()))
+    {
+      return false;
+    }
+    for (const data_expression& u: ta)
+    {
+      if (!is_closed_term(u))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  return false;
+}
+
 data_expression RewriterJitty::rewrite_aux_function_symbol(
                       const function_symbol& op,
                       const data_expression& term,
                       substitution_type& sigma)
+{
+  // The normal form of a closed term does not depend on sigma, and can therefore be cached.
+  if (m_memo_cache && !is_function_symbol(term))
+  {
+    const std::size_t op_value=core::index_traits<data::function_symbol,function_symbol_key_type, 2>::index(op);
+    if (op_value < m_memoised.size() && m_memoised[op_value] && is_closed_term(term))
+    {
+      const data_expression* cached = m_memo_cache->find(term);
+      if (cached != nullptr)
+      {
+        return *cached;
+      }
+      const data_expression result = rewrite_aux_function_symbol_without_cache(op,term,sigma);
+      m_memo_cache->insert(term,result);
+      return result;
+    }
+  }
+  return rewrite_aux_function_symbol_without_cache(op,term,sigma);
+}
+
+data_expression RewriterJitty::rewrite_aux_function_symbol_without_cache(
+                      const function_symbol& op,
+                      const data_expression& term,
+                      substitution_type& sigma)
 {
   // The first term is function symbol; apply the necessary rewrite rules using a jitty strategy.
 
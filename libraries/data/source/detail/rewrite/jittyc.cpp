@@ -32,8 +32,10 @@
 #include "mcrl2/utilities/logger.h"
 #include "mcrl2/utilities/stopwatch.h"
 #include "mcrl2/atermpp/algorithm.h"
+#include "mcrl2/atermpp/aterm_io.h"
 #include "mcrl2/core/print.h"
 #include "mcrl2/core/detail/function_symbols.h"
+#include "mcrl2/data/detail/io.h"
 #include "mcrl2/data/detail/rewrite/jittyc.h"
 #include "mcrl2/data/detail/rewrite/jitty_jittyc.h"
 #include "mcrl2/data/replace.h"
@@ -997,6 +999,8 @@ class RewriterCompilingJitty::ImplementTree
   std::stack<rewr_function_spec> m_rewr_functions;
   std::set<rewr_function_spec> m_rewr_functions_implemented;
   std::set<std::size_t>m_delayed_application_functions; // Recalls the arities of the required functions 'delayed_application';
+  const rewr_function_spec* m_current_function = nullptr; // The rewrite function that is being generated.
+  std::vector<std::pair<rewr_function_spec, rewr_function_spec> > m_calls; // Pairs of a rewrite function and a function it refers to.
   std::vector<bool> m_used;
   std::vector<int> m_stack;
   padding m_padding;
@@ -1116,6 +1120,15 @@ class RewriterCompilingJitty::ImplementTree
     return "make_term_with_many_arguments";
   }
 
+  inline
+  void register_call(const rewr_function_spec& spec)
+  {
+    if (m_current_function != nullptr)
+    {
+      m_calls.emplace_back(*m_current_function, spec);
+    }
+  }
+
   inline
   const std::string rewr_function_name(const function_symbol& f, std::size_t arity)
   {
@@ -1124,6 +1137,7 @@ class RewriterCompilingJitty::ImplementTree
     {
       m_rewr_functions.push(spec);
     }
+    register_call(spec);
     return spec.name();
   }
 
@@ -1135,6 +1149,7 @@ class RewriterCompilingJitty::ImplementTree
     {
       m_rewr_functions.push(spec);
     }
+    register_call(spec);
     rewr_function_name(f,arity); // Also declare the non delayed function.
     return spec.name();
   }
@@ -1779,7 +1794,7 @@ class RewriterCompilingJitty::ImplementTree
              std::stack<std::string>& auxiliary_code_fragments)
   {
     bool reset_current_data_parameters=false;
-    const void* func = (void*)(atermpp::detail::address(tree.function()));
+    const std::string func = "uint_address(" + m_rewriter.m_nf_cache.insert_term(tree.function()) + ")";
     m_stream << m_padding;
     brackets.bracket_nesting_level++;
     if (level == 0)
@@ -2245,10 +2260,8 @@ public:
     }
     else
     {
-      stringstream ss;
-      ss << "atermpp::down_cast<data_expression>(atermpp::aterm(reinterpret_cast<atermpp::detail::_aterm*>(" << (void*)atermpp::detail::address(opid) << ")))";
       std::size_t used_arguments = 0;
-      m_stream << rewr_function_finish_term(arity, ss.str(), down_cast<function_sort>(opid.sort()), used_arguments) << ";\n";
+      m_stream << rewr_function_finish_term(arity, m_rewriter.m_nf_cache.insert_term(opid), down_cast<function_sort>(opid.sort()), used_arguments) << ";\n";
       assert(used_arguments == arity);
     } 
   }
@@ -2397,27 +2410,112 @@ public:
     m_stream << m_padding << "\n";
   }
 
-  void generate_rewr_functions(std::ostream& m_stream)
+  ///
+  /// \brief generate_rewr_functions generates the code of the rewrite functions, and distributes
+  ///        it over the given number of parts, that are compiled as separate translation units.
+  ///        The rewrite functions are templates that are instantiated by the functions that call
+  ///        them. Therefore, functions that call each other, directly or indirectly, are put in
+  ///        the same part. The parts are balanced on the size of their code.
+  /// \param parts The vector in which the code of each part is stored. Its size is the number of parts.
+  /// \param part_of The part of each rewrite function.
+  ///
+  void generate_rewr_functions(std::vector<std::string>& parts, std::map<rewr_function_spec, std::size_t>& part_of)
   {
+    std::vector<std::pair<rewr_function_spec, std::string> > functions;
     while (!m_rewr_functions.empty())
     {
       rewr_function_spec spec = m_rewr_functions.top();
       m_rewr_functions.pop();
+      m_current_function = &spec;
+      std::stringstream code;
       if (spec.delayed())
       {
-        generate_delayed_normal_form_generating_function(m_stream, spec.fs(), spec.arity());
+        generate_delayed_normal_form_generating_function(code, spec.fs(), spec.arity());
+        register_call(rewr_function_spec(spec.fs(), spec.arity(), false));
       }
       else
       {
         const match_tree_list strategy = m_rewriter.create_strategy(m_rewriter.jittyc_eqns[spec.fs()], spec.arity());
-        rewr_function_implementation(m_stream, spec.fs(), spec.arity(), strategy);
+        rewr_function_implementation(code, spec.fs(), spec.arity(), strategy);
+      }
+      m_current_function = nullptr;
+      functions.emplace_back(spec, code.str());
+    }
+
+    // Determine the groups of functions that call each other using a union-find structure.
+    std::map<rewr_function_spec, std::size_t> index;
+    for (const std::pair<rewr_function_spec, std::string>& f: functions)
+    {
+      index.insert(std::make_pair(f.first, index.size()));
+    }
+    std::vector<std::size_t> parent(functions.size());
+    for (std::size_t i = 0; i < parent.size(); ++i)
+    {
+      parent[i] = i;
+    }
+    auto find = [&](std::size_t i)
+    {
+      while (parent[i] != i)
+      {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+      }
+      return i;
+    };
+    for (const std::pair<rewr_function_spec, rewr_function_spec>& call: m_calls)
+    {
+      parent[find(index.at(call.first))] = find(index.at(call.second));
+    }
+
+    // Assign the groups, largest first, to the part with the least code so far.
+    std::vector<std::size_t> group_size(functions.size(), 0);
+    for (std::size_t i = 0; i < functions.size(); ++i)
+    {
+      group_size[find(i)] += functions[i].second.size();
+    }
+    std::vector<std::size_t> groups;
+    for (std::size_t i = 0; i < functions.size(); ++i)
+    {
+      if (find(i) == i)
+      {
+        groups.push_back(i);
       }
     }
+    std::stable_sort(groups.begin(), groups.end(), [&](std::size_t x, std::size_t y) { return group_size[x] > group_size[y]; });
+    std::vector<std::size_t> part_size(parts.size(), 0);
+    std::vector<std::size_t> part_of_group(functions.size(), 0);
+    for (std::size_t group: groups)
+    {
+      const std::size_t part = std::min_element(part_size.begin(), part_size.end()) - part_size.begin();
+      part_of_group[group] = part;
+      part_size[part] += group_size[group];
+    }
+
+    for (std::size_t i = 0; i < functions.size(); ++i)
+    {
+      const std::size_t part = part_of_group[find(i)];
+      part_of[functions[i].first] = part;
+      parts[part] += functions[i].second;
+    }
   }
 };
 
 void RewriterCompilingJitty::CleanupRewriteSystem()
 {
+  join_optimised_rewriter_thread();
+  if (m_optimised_rewriter_so)
+  {
+    // The optimised rewriter has not been loaded, so its files have not been removed yet.
+    try
+    {
+      m_optimised_rewriter_so->cleanup();
+    }
+    catch (std::runtime_error& error)
+    {
+      mCRL2log(mcrl2::log::error) << "Could not cleanup temporary files: " << error.what() << std::endl;
+    }
+    m_optimised_rewriter_so.reset();
+  }
   m_nf_cache.clear();
   if (so_rewr_cleanup != NULL)
   {
@@ -2430,9 +2528,10 @@ void RewriterCompilingJitty::CleanupRewriteSystem()
 ///        name clashes when more than one instance of the compiling rewriter run at the same
 ///        time.
 /// \param unique A number that will be incorporated into the filename.
+/// \param suffix A string that is appended to the filename, before the extension.
 /// \return A filename that should be used to store the generated C++ code in.
 ///
-static std::string generate_cpp_filename(std::size_t unique)
+static std::string generate_cpp_filename(std::size_t unique, const std::string& suffix = std::string())
 {
   const char* env_dir = std::getenv("MCRL2_COMPILEDIR");
   std::ostringstream filename;
@@ -2449,10 +2548,52 @@ static std::string generate_cpp_filename(std::size_t unique)
   {
     filedir = "./";
   }
-  filename << filedir << "jittyc_" << getpid() << "_" << unique << ".cpp";
+  filename << filedir << "jittyc_" << getpid() << "_" << unique << suffix << ".cpp";
   return filename.str();
 }
 
+///
+/// \brief compile_cache_directory determines the directory in which compiled rewriters are cached.
+///        It is given by the environment variable MCRL2_COMPILECACHE. If this variable is not set,
+///        the directory mcrl2/jittyc in the user's cache directory is used.
+/// \return The cache directory, or an empty string if compiled rewriters should not be cached.
+///
+static std::string compile_cache_directory()
+{
+  const char* env_cache = std::getenv("MCRL2_COMPILECACHE");
+  if (env_cache)
+  {
+    return env_cache;
+  }
+  const char* env_xdg_cache = std::getenv("XDG_CACHE_HOME");
+  if (env_xdg_cache && *env_xdg_cache != '\0')
+  {
+    return std::string(env_xdg_cache) + "/mcrl2/jittyc";
+  }
+  const char* env_home = std::getenv("HOME");
+  if (env_home && *env_home != '\0')
+  {
+    return std::string(env_home) + "/.cache/mcrl2/jittyc";
+  }
+  return std::string();
+}
+
+///
+/// \brief compile_jobs determines the number of translation units over which the generated code
+///        is distributed, such that they can be compiled in parallel. It is given by the environment
+///        variable MCRL2_COMPILEJOBS, and is the number of hardware threads by default.
+///
+static std::size_t compile_jobs()
+{
+  const char* env_jobs = std::getenv("MCRL2_COMPILEJOBS");
+  if (env_jobs)
+  {
+    const long jobs = std::atol(env_jobs);
+    return jobs > 0 ? static_cast<std::size_t>(jobs) : 1;
+  }
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
 ///
 /// \brief filter_function_symbols selects the function symbols from source for which filter
 ///        returns true, and copies them to dest.
@@ -2504,10 +2645,8 @@ static void generate_make_appl_functions(std::ostream& s, std::size_t max_arity)
   }
 }
 
-void RewriterCompilingJitty::generate_code(const std::string& filename)
+std::vector<std::string> RewriterCompilingJitty::generate_code(std::size_t number_of_parts)
 {
-  std::ofstream cpp_file(filename);
-  std::stringstream rewr_code;
   // arity_bound is one larger than the maximal arity. 
   arity_bound = 1+std::max(calc_max_arity(m_data_specification_for_enumeration.constructors()),
                            calc_max_arity(m_data_specification_for_enumeration.mappings()));
@@ -2529,66 +2668,182 @@ void RewriterCompilingJitty::generate_code(const std::string& filename)
   functions_when_arguments_are_not_in_normal_form = std::vector<rewriter_function>(arity_bound * index_bound);
   functions_when_arguments_are_in_normal_form = std::vector<rewriter_function>(arity_bound * index_bound);
 
-  cpp_file << "#define INDEX_BOUND__ " << index_bound << "// These values are not used anymore.\n"
-              "#define ARITY_BOUND__ " << arity_bound << "// These values are not used anymore.\n";
-  cpp_file << "#include \"mcrl2/data/detail/rewrite/jittycpreamble.h\"\n";
-
-  cpp_file << "namespace {\n"
-               "// Anonymous namespace so the compiler uses internal linkage for the generated\n"
-               "// rewrite code.\n"
-               "\n"
-               "struct rewr_functions\n"
-               "{\n"
-
-               "  // A rewrite_term is a term that may or may not be in normal form. If the method\n"
-               "  // normal_form is invoked, it will calculate a normal form for itself as efficiently as possible.\n"
-               "  template <class REWRITE_TERM>\n"
-               "  static data_expression local_rewrite(const REWRITE_TERM& t, RewriterCompilingJitty* this_rewriter)\n"
-               "  {\n"
-               "    return t.normal_form();\n"
-               "  }\n"
-               "\n"
-               "  static const data_expression& local_rewrite(const data_expression& t, RewriterCompilingJitty* )\n"
-               "  {\n"
-               "    return t;\n"
-               "  }\n"
-               "\n";
-
-  rewr_code << "  // We're declaring static members in a struct rather than simple functions in\n"
-               "  // the global scope, so that we don't have to worry about forward declarations.\n";
-  code_generator.generate_rewr_functions(rewr_code);
-  rewr_code << "};\n"
-               "} // namespace\n";
-
-  generate_make_appl_functions(cpp_file, arity_bound);
-  code_generator.generate_delayed_application_functions(cpp_file);
-
-  cpp_file << rewr_code.str();
-
-  cpp_file << "void set_the_precompiled_rewrite_functions_in_a_lookup_table(RewriterCompilingJitty* this_rewriter)\n"
-              "{\n";
-
-  // Fill tables with the rewrite functions
+  // The rewrite functions are distributed over the files, each of which is compiled separately.
+  // Parts that remain empty are not generated.
+  std::vector<std::string> rewr_code(number_of_parts);
+  std::map<rewr_function_spec, std::size_t> part_of;
+  code_generator.generate_rewr_functions(rewr_code, part_of);
+  std::vector<std::string> filenames;
+  for (std::size_t part = 0; part < number_of_parts && (part == 0 || !rewr_code[part].empty()); ++part)
+  {
+    filenames.push_back(generate_cpp_filename(reinterpret_cast<std::size_t>(this), part == 0 ? std::string() : "_" + std::to_string(part)));
+  }
+
+  // Fill tables with the rewrite functions. The function symbols are stored in the cache of
+  // terms, because their indices may differ in the process that loads the generated code.
+  std::vector<std::stringstream> table_code(filenames.size());
   for (std::set<rewr_function_spec>::const_iterator
             it = code_generator.implemented_rewrs().begin();
             it != code_generator.implemented_rewrs().end(); ++it)
   {
     if (!it->delayed())
     {
-      cpp_file << "  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * "
-               << core::index_traits<data::function_symbol, function_symbol_key_type, 2>::index(it->fs())
-               << " + " << it->arity() << "] = rewr_functions::"
-               << it->name() << "_term;\n";
-      cpp_file << "  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * "
-               << core::index_traits<data::function_symbol, function_symbol_key_type, 2>::index(it->fs())
-               << " + " << it->arity() << "] = rewr_functions::"
-               << it->name() << "_term_arg_in_normal_form;\n";
+      std::stringstream& table = table_code[part_of.at(*it)];
+      const std::string index = "get_index(down_cast<function_symbol>(" + m_nf_cache.insert_term(it->fs()) + "))";
+      table << "  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * "
+            << index << " + " << it->arity() << "] = rewr_functions::"
+            << it->name() << "_term;\n";
+      table << "  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * "
+            << index << " + " << it->arity() << "] = rewr_functions::"
+            << it->name() << "_term_arg_in_normal_form;\n";
     }
   }
 
+  for (std::size_t part = 0; part < filenames.size(); ++part)
+  {
+    std::ofstream cpp_file(filenames[part]);
+    if (part > 0)
+    {
+      // Only the first part defines the interface of the library.
+      cpp_file << "#define MCRL2_JITTYC_PART " << part << "\n";
+    }
+    cpp_file << "#define INDEX_BOUND__ " << index_bound << "// These values are not used anymore.\n"
+                "#define ARITY_BOUND__ " << arity_bound << "// These values are not used anymore.\n";
+    cpp_file << "#include \"mcrl2/data/detail/rewrite/jittycpreamble.h\"\n";
+
+    cpp_file << "namespace {\n"
+                 "// Anonymous namespace so the compiler uses internal linkage for the generated\n"
+                 "// rewrite code.\n"
+                 "\n"
+                 "struct rewr_functions\n"
+                 "{\n"
 
-  cpp_file << "}\n";
-  cpp_file.close();
+                 "  // A rewrite_term is a term that may or may not be in normal form. If the method\n"
+                 "  // normal_form is invoked, it will calculate a normal form for itself as efficiently as possible.\n"
+                 "  template <class REWRITE_TERM>\n"
+                 "  static data_expression local_rewrite(const REWRITE_TERM& t, RewriterCompilingJitty* this_rewriter)\n"
+                 "  {\n"
+                 "    return t.normal_form();\n"
+                 "  }\n"
+                 "\n"
+                 "  static const data_expression& local_rewrite(const data_expression& t, RewriterCompilingJitty* )\n"
+                 "  {\n"
+                 "    return t;\n"
+                 "  }\n"
+                 "\n";
+
+    generate_make_appl_functions(cpp_file, arity_bound);
+    code_generator.generate_delayed_application_functions(cpp_file);
+
+    cpp_file << "  // We're declaring static members in a struct rather than simple functions in\n"
+                "  // the global scope, so that we don't have to worry about forward declarations.\n";
+    cpp_file << rewr_code[part];
+    cpp_file << "};\n"
+                "} // namespace\n";
+
+    if (part > 0)
+    {
+      cpp_file << "void set_the_precompiled_rewrite_functions_in_a_lookup_table_" << part << "(RewriterCompilingJitty* this_rewriter)\n"
+                  "{\n";
+    }
+    else
+    {
+      for (std::size_t i = 1; i < filenames.size(); ++i)
+      {
+        cpp_file << "void set_the_precompiled_rewrite_functions_in_a_lookup_table_" << i << "(RewriterCompilingJitty* this_rewriter);\n";
+      }
+      cpp_file << "void set_the_precompiled_rewrite_functions_in_a_lookup_table(RewriterCompilingJitty* this_rewriter)\n"
+                  "{\n"
+                  "  this_rewriter->load_generated_code_data(R\"mcrl2(" << generated_code_data() << ")mcrl2\");\n";
+      for (std::size_t i = 1; i < filenames.size(); ++i)
+      {
+        cpp_file << "  set_the_precompiled_rewrite_functions_in_a_lookup_table_" << i << "(this_rewriter);\n";
+      }
+    }
+    cpp_file << table_code[part].str();
+    cpp_file << "}\n";
+    cpp_file.close();
+  }
+  return filenames;
+}
+
+// The data that is needed by the generated code consists of arity_bound, the terms in m_nf_cache,
+// the binding variable lists and the bound variables. The indices of function symbols and variables
+// are removed, because they are specific to the process that generates the code.
+std::string RewriterCompilingJitty::generated_code_data() const
+{
+  const atermpp::aterm_list data = {
+    atermpp::aterm_int(arity_bound),
+    data_expression_list(m_nf_cache.terms().begin(), m_nf_cache.terms().end()),
+    atermpp::term_list<variable_list>(rewriter_binding_variable_lists.begin(), rewriter_binding_variable_lists.end()),
+    variable_list(rewriter_bound_variables.begin(), rewriter_bound_variables.end())
+  };
+  std::ostringstream out;
+  atermpp::write_term_to_text_stream(data::detail::remove_index(data), out);
+  return out.str();
+}
+
+void RewriterCompilingJitty::load_generated_code_data(const std::string& data)
+{
+  const atermpp::aterm_list l = atermpp::down_cast<atermpp::aterm_list>(data::detail::add_index(atermpp::read_term_from_string(data)));
+  assert(l.size() == 4);
+  atermpp::aterm_list::const_iterator i = l.begin();
+  arity_bound = atermpp::down_cast<atermpp::aterm_int>(*i++).value();
+
+  const data_expression_list& terms = atermpp::down_cast<data_expression_list>(*i++);
+  m_nf_cache.set_terms(std::vector<data_expression>(terms.begin(), terms.end()));
+
+  rewriter_binding_variable_lists.clear();
+  variable_list_indices1.clear();
+  for (const variable_list& vl: atermpp::down_cast<atermpp::term_list<variable_list> >(*i++))
+  {
+    binding_variable_list_index(vl);
+  }
+
+  rewriter_bound_variables.clear();
+  variable_indices0.clear();
+  for (const variable& v: atermpp::down_cast<variable_list>(*i++))
+  {
+    bound_variable_index(v);
+  }
+
+  index_bound = core::index_traits<data::function_symbol, function_symbol_key_type, 2>::max_index() + 1;
+  functions_when_arguments_are_not_in_normal_form = std::vector<rewriter_function>(arity_bound * index_bound);
+  functions_when_arguments_are_in_normal_form = std::vector<rewriter_function>(arity_bound * index_bound);
+}
+
+// The key under which the compiled rewriter is cached. It consists of the toolset version, the
+// function symbols and the rewrite rules, without the indices of function symbols and variables.
+// The function symbols and rewrite rules are sorted on their textual representation, because
+// their order may depend on the addresses of terms.
+std::string RewriterCompilingJitty::compile_cache_key() const
+{
+  std::vector<function_symbol> function_symbols;
+  filter_function_symbols(m_data_specification_for_enumeration.constructors(), function_symbols, data_equation_selector);
+  filter_function_symbols(m_data_specification_for_enumeration.mappings(), function_symbols, data_equation_selector);
+
+  std::vector<std::string> lines;
+  for (const function_symbol& f: function_symbols)
+  {
+    std::ostringstream line;
+    line << data::detail::remove_index(f);
+    lines.push_back(line.str());
+  }
+  for (const data_equation& e: rewrite_rules)
+  {
+    std::ostringstream line;
+    line << data::detail::remove_index(e);
+    lines.push_back(line.str());
+  }
+  std::sort(lines.begin(), lines.end());
+
+  std::ostringstream out;
+  out << mcrl2::utilities::get_toolset_version() << "\n";
+  for (const std::string& line: lines)
+  {
+    out << line << "\n";
+  }
+  return out.str();
 }
 
 void RewriterCompilingJitty::BuildRewriteSystem()
@@ -2630,24 +2885,75 @@ void RewriterCompilingJitty::BuildRewriteSystem()
     jittyc_eqns[down_cast<function_symbol>(get_nested_head(it->lhs()))].push_front(*it);
   }
 
-  std::string cpp_file = generate_cpp_filename(reinterpret_cast<std::size_t>(this));
-  generate_code(cpp_file);
-
-  mCRL2log(verbose) << "generated " << cpp_file << " in " << time.time() << "ms, compiling..." << std::endl;
-  time.reset();
-
-  try
+  const std::string cache_directory = compile_cache_directory();
+  const std::string cache_key = cache_directory.empty() ? std::string() : compile_cache_key();
+  if (!cache_directory.empty() && rewriter_so->load_from_cache(cache_directory, cache_key))
   {
-    rewriter_so->compile(cpp_file);
+    mCRL2log(verbose) << "found a compiled rewriter in " << cache_directory << ", loading rewriter..." << std::endl;
   }
-  catch(std::runtime_error& e)
+  else
   {
-    rewriter_so->leave_files();
-    throw mcrl2::runtime_error(std::string("Could not compile rewriter: ") + e.what());
+    const std::vector<std::string> cpp_files = generate_code(compile_jobs());
+
+    mCRL2log(verbose) << "generated " << cpp_files.front() << " and " << cpp_files.size() - 1 << " more files in " << time.time() << "ms, compiling..." << std::endl;
+    time.reset();
+
+    // If quick compiler flags are given, a rewriter is compiled with these flags, such that rewriting
+    // can start early. In the meantime a copy of the code is compiled with the default flags in the
+    // background, and this rewriter is swapped in by rewrite() when it is ready.
+    const char* env_quick_flags = std::getenv("MCRL2_COMPILEQUICKFLAGS");
+    try
+    {
+      if (env_quick_flags != nullptr)
+      {
+        std::vector<std::string> optimised_cpp_files;
+        for (const std::string& cpp_file: cpp_files)
+        {
+          const std::string optimised_cpp_file = cpp_file.substr(0, cpp_file.size() - 4) + "_optimised.cpp";
+          std::ifstream in(cpp_file);
+          std::ofstream out(optimised_cpp_file);
+          out << in.rdbuf();
+          optimised_cpp_files.push_back(optimised_cpp_file);
+        }
+
+        m_optimised_rewriter_so = std::shared_ptr<uncompiled_library>(new uncompiled_library(compile_script));
+        m_optimised_rewriter_error.clear();
+        m_optimised_rewriter_ready = false;
+        m_optimised_rewriter_thread = std::thread([this, optimised_cpp_files, cache_directory, cache_key]()
+          {
+            try
+            {
+              m_optimised_rewriter_so->compile(optimised_cpp_files, cache_directory, cache_key);
+            }
+            catch (std::runtime_error& e)
+            {
+              m_optimised_rewriter_so->leave_files();
+              m_optimised_rewriter_error = e.what();
+            }
+            m_optimised_rewriter_ready = true;
+          });
+
+        rewriter_so->compile(cpp_files, env_quick_flags);
+      }
+      else
+      {
+        rewriter_so->compile(cpp_files, cache_directory, cache_key);
+      }
+    }
+    catch(std::runtime_error& e)
+    {
+      rewriter_so->leave_files();
+      throw mcrl2::runtime_error(std::string("Could not compile rewriter: ") + e.what());
+    }
+
+    mCRL2log(verbose) << "compiled in " << time.time() << "ms, loading rewriter..." << std::endl;
   }
 
-  mCRL2log(verbose) << "compiled in " << time.time() << "ms, loading rewriter..." << std::endl;
+  load_rewriter_library();
+}
 
+void RewriterCompilingJitty::load_rewriter_library()
+{
   bool (*init)(rewriter_interface*, RewriterCompilingJitty* this_rewriter);
   rewriter_interface interface = { mcrl2::utilities::get_toolset_version(), "Unknown error when loading rewriter.", this, NULL, NULL };
   try
@@ -2686,14 +2992,49 @@ void RewriterCompilingJitty::BuildRewriteSystem()
   mCRL2log(verbose) << interface.status << std::endl;
 }
 
+void RewriterCompilingJitty::join_optimised_rewriter_thread()
+{
+  if (m_optimised_rewriter_thread.joinable())
+  {
+    m_optimised_rewriter_thread.join();
+  }
+  m_optimised_rewriter_ready = false;
+}
+
+void RewriterCompilingJitty::load_optimised_rewriter()
+{
+  join_optimised_rewriter_thread();
+  if (!m_optimised_rewriter_error.empty())
+  {
+    mCRL2log(warning) << "Could not compile the optimised rewriter, continuing with the quickly compiled one: "
+                      << m_optimised_rewriter_error << std::endl;
+    m_optimised_rewriter_so.reset();
+    return;
+  }
+
+  // The loaded code refers to the rewriter through this_rewriter only, hence the old library can be
+  // unloaded as soon as the new one has been initialised.
+  if (so_rewr_cleanup != NULL)
+  {
+    so_rewr_cleanup();
+  }
+  std::shared_ptr<uncompiled_library> quick_rewriter_so = rewriter_so;
+  rewriter_so = m_optimised_rewriter_so;
+  m_optimised_rewriter_so.reset();
+  load_rewriter_library();
+  mCRL2log(verbose) << "switched to the optimised rewriter." << std::endl;
+}
+
 RewriterCompilingJitty::RewriterCompilingJitty(
                           const data_specification& data_spec,
                           const used_data_equation_selector& equation_selector)
   : Rewriter(data_spec,equation_selector),
     jitty_rewriter(data_spec,equation_selector),
-    m_nf_cache(jitty_rewriter)
+    m_nf_cache(jitty_rewriter),
+    m_optimised_rewriter_ready(false)
 {
   so_rewr_cleanup = NULL;
+  global_sigma = nullptr;
 
   made_files = false;
   rewrite_rules.clear();
@@ -2734,6 +3075,13 @@ data_expression RewriterCompilingJitty::rewrite(
 #ifdef MCRL2_DISPLAY_REWRITE_STATISTICS
   data::detail::increment_rewrite_count();
 #endif
+  // An optimised rewriter that has been compiled in the background can only be swapped in
+  // when no rewriting is in progress.
+  if (m_optimised_rewriter_ready.load(std::memory_order_relaxed) && global_sigma == nullptr)
+  {
+    load_optimised_rewriter();
+  }
+
   // Save global sigma and restore it afterwards, as rewriting might be recursive with different
   // substitutions, due to the enumerator.
   substitution_type *saved_sigma=global_sigma;
@@ -13,6 +13,7 @@
 #include "mcrl2/data/detail/data_functional.h"
 #include "mcrl2/data/detail/one_point_rule_preprocessor.h"
 #include "mcrl2/data/detail/parse_substitution.h"
+#include "mcrl2/data/detail/rewrite/jitty.h"
 #include "mcrl2/data/detail/test_rewriters.h"
 #include "mcrl2/data/find.h"
 #include "mcrl2/data/function_sort.h"
@@ -252,6 +253,40 @@ void test_enumeration_of_functions()
   test_expressions(R, expr1, expr2, "", data_spec, sigma);
 }
 
+// Checks that the normal forms of the jitty rewriter do not change when normal forms of a recursive
+// function are cached, also when the cache is too small to contain all of them.
+void test_memo_cache()
+{
+  std::string DATA_SPEC1 =
+    "map fib: Nat -> Nat;\n"
+    "var n: Nat;\n"
+    "eqn n <= 1 -> fib(n) = n;\n"
+    "    n > 1 -> fib(n) = fib(Int2Nat(n - 1)) + fib(Int2Nat(n - 2));\n"
+    ;
+  data_specification data_spec = parse_data_specification(DATA_SPEC1);
+  data_expression t = parse_data_expression("fib(18) + fib(18)", data_spec);
+  RewriterJitty::substitution_type sigma;
+  data_expression expected = RewriterJitty(data_spec, used_data_equation_selector(data_spec)).rewrite(t, sigma);
+  BOOST_CHECK_EQUAL(expected, sort_nat::nat(5168));
+
+  for (memo_cache_policy policy: { memo_cache_policy::fifo, memo_cache_policy::clock })
+  {
+    for (std::size_t max_size: { 16, 1024 })
+    {
+      RewriterJitty R(data_spec, used_data_equation_selector(data_spec));
+      R.enable_memo_cache(max_size, policy);
+      BOOST_CHECK(R.get_memo_cache() != nullptr);
+      BOOST_CHECK_EQUAL(R.rewrite(t, sigma), expected);
+      BOOST_CHECK(R.get_memo_cache()->hits() > 0);
+    }
+  }
+
+  // A cache of size zero is disabled.
+  RewriterJitty R(data_spec, used_data_equation_selector(data_spec));
+  R.enable_memo_cache(0);
+  BOOST_CHECK(R.get_memo_cache() == nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(test_main)
 {
   test1();
@@ -263,4 +298,5 @@ BOOST_AUTO_TEST_CASE(test_main)
   test_lambda_expression();
   test_equality_on_functions();
   test_enumeration_of_functions();
+  test_memo_cache();
 }
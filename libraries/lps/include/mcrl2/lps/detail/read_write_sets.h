@@ -0,0 +1,131 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/lps/detail/read_write_sets.h
+/// \brief The process parameters that are read and written by the summands of a linear process.
+
+#ifndef MCRL2_LPS_DETAIL_READ_WRITE_SETS_H
+#define MCRL2_LPS_DETAIL_READ_WRITE_SETS_H
+
+#include <map>
+#include <set>
+#include <vector>
+#include "mcrl2/data/find.h"
+#include "mcrl2/process/timed_multi_action.h"
+#include "mcrl2/utilities/detail/container_utility.h"
+
+namespace mcrl2 {
+
+namespace lps {
+
+namespace detail {
+
+/// \brief Maps process parameters to their position.
+class parameter_positions
+{
+  protected:
+    std::map<data::variable, std::size_t> m_position;
+
+  public:
+    explicit parameter_positions(const std::vector<data::variable>& process_parameters)
+    {
+      for (std::size_t i = 0; i < process_parameters.size(); i++)
+      {
+        m_position[process_parameters[i]] = i;
+      }
+    }
+
+    /// \brief Returns the positions of the process parameters that occur freely in x.
+    std::set<std::size_t> operator()(const data::data_expression& x) const
+    {
+      std::set<std::size_t> result;
+      for (const data::variable& v: data::find_free_variables(x))
+      {
+        auto i = m_position.find(v);
+        if (i != m_position.end())
+        {
+          result.insert(i->second);
+        }
+      }
+      return result;
+    }
+
+    /// \brief Removes the positions of the process parameters in v from P.
+    void erase(std::set<std::size_t>& P, const data::variable_list& v) const
+    {
+      for (const data::variable& vi: v)
+      {
+        auto i = m_position.find(vi);
+        if (i != m_position.end())
+        {
+          P.erase(i->second);
+        }
+      }
+    }
+};
+
+/// \brief The positions of the process parameters that a summand tests in its condition (Ts), writes in its
+/// next state (Ws), and reads in its next state, actions and time (Rs).
+struct read_write_sets
+{
+  std::set<std::size_t> Ts;
+  std::set<std::size_t> Ws;
+  std::set<std::size_t> Rs;
+
+  /// \brief Returns all parameters that the summand uses.
+  std::set<std::size_t> Vs() const
+  {
+    return utilities::detail::set_union(Ts, utilities::detail::set_union(Ws, Rs));
+  }
+};
+
+/// \brief Computes the read and write sets of a summand with attributes variables, condition, multi_action and
+/// next_state, where next_state contains an expression for every process parameter.
+template <typename Summand>
+read_write_sets compute_read_write_sets(const Summand& summand,
+                                        const std::vector<data::variable>& process_parameters,
+                                        const parameter_positions& positions)
+{
+  read_write_sets result;
+
+  // Summation variables that have the name of a process parameter hide that parameter in the condition.
+  result.Ts = positions(summand.condition);
+  positions.erase(result.Ts, summand.variables);
+
+  for (std::size_t i = 0; i < process_parameters.size(); i++)
+  {
+    if (summand.next_state[i] != process_parameters[i])
+    {
+      result.Ws.insert(i);
+      std::set<std::size_t> R = positions(summand.next_state[i]);
+      result.Rs.insert(R.begin(), R.end());
+    }
+  }
+  for (const process::action& a: summand.multi_action.actions())
+  {
+    for (const data::data_expression& x: a.arguments())
+    {
+      std::set<std::size_t> R = positions(x);
+      result.Rs.insert(R.begin(), R.end());
+    }
+  }
+  if (summand.multi_action.has_time())
+  {
+    std::set<std::size_t> R = positions(summand.multi_action.time());
+    result.Rs.insert(R.begin(), R.end());
+  }
+  return result;
+}
+
+} // namespace detail
+
+} // namespace lps
+
+} // namespace mcrl2
+
+#endif // MCRL2_LPS_DETAIL_READ_WRITE_SETS_H
@@ -36,6 +36,7 @@
 #include "mcrl2/process/timed_multi_action.h"
 #include "mcrl2/utilities/detail/container_utility.h"
 #include "mcrl2/utilities/detail/io.h"
+#include "mcrl2/utilities/indexed_set.h"
 #include "mcrl2/utilities/skip.h"
 #include "mcrl2/utilities/unused.h"
 
@@ -374,7 +375,7 @@ class explorer: public abortable
 
     // N.B. The keys are stored in term_appl instead of data_expression_list for performance reasons.
     std::unordered_map<atermpp::term_appl<data::data_expression>, std::list<data::data_expression_list>> global_cache;
-    std::unordered_map<state, std::size_t> m_discovered;
+    utilities::indexed_set<state> m_discovered;
 
     // used by make_timed_state, to avoid needless creation of vectors
     mutable std::vector<data::data_expression> timed_state;
@@ -828,7 +829,7 @@ class explorer: public abortable
       const StateType& s0,
       const SummandSequence& regular_summands,
       const SummandSequence& confluent_summands,
-      std::unordered_map<state, std::size_t>& discovered,
+      utilities::indexed_set<state>& discovered,
       DiscoverState discover_state = DiscoverState(),
       ExamineTransition examine_transition = ExamineTransition(),
       StartState start_state = StartState(),
@@ -852,29 +853,26 @@ class explorer: public abortable
         for (const state& s: S)
         {
           // TODO: join duplicate targets
-          auto j = discovered.find(s);
-          if (j == discovered.end())
+          std::pair<std::size_t, bool> k = discovered.insert(s);
+          if (k.second)
           {
-            std::size_t s_index = discovered.size();
-            j = discovered.insert(std::make_pair(s, s_index)).first;
-            discover_state(s, s_index);
+            discover_state(s, k.first);
           }
-          s0_index.push_back(j->second);
+          s0_index.push_back(k.first);
         }
         discover_initial_state(s0_, s0_index);
       }
       else
       {
         todo = make_todo_set(s0);
-        std::size_t s0_index = 0;
-        discovered.insert(std::make_pair(s0, s0_index));
+        std::size_t s0_index = discovered.insert(s0).first;
         discover_state(s0, s0_index);
       }
 
       while (!todo->empty() && !m_must_abort)
       {
         state s = todo->choose_element();
-        std::size_t s_index = discovered.find(s)->second;
+        std::size_t s_index = discovered.index(s);
         start_state(s, s_index);
         data::add_assignments(m_sigma, m_process_parameters, s);
         for (const explorer_summand& summand: regular_summands)
@@ -899,42 +897,41 @@ class explorer: public abortable
                 // TODO: join duplicate targets
                 for (const state& s1_: S1)
                 {
-                  auto j = discovered.find(s1_);
-                  if (j == discovered.end())
+                  std::pair<std::size_t, bool> k = discovered.insert(s1_);
+                  if (k.second)
                   {
                     todo->insert(s1_);
-                    std::size_t k = discovered.size();
-                    j = discovered.insert(std::make_pair(s1_, k)).first;
-                    discover_state(s1_, k);
+                    discover_state(s1_, k.first);
                   }
-                  s1_index.push_back(j->second);
+                  s1_index.push_back(k.first);
                 }
                 examine_transition(s, s_index, a, s1, s1_index, summand.index);
               }
               else
               {
-                auto j = discovered.find(s1);
-                if (j == discovered.end())
+                if constexpr (Timed)
                 {
-                  std::size_t k = discovered.size();
-                  if constexpr (Timed)
+                  const data::data_expression& t = s[m_n];
+                  data::data_expression t1 = a.has_time() ? a.time() : t;
+                  state s1_at_t1 = make_timed_state(s1, t1);
+                  std::pair<std::size_t, bool> k = discovered.insert(s1_at_t1);
+                  if (k.second)
                   {
-                    const data::data_expression& t = s[m_n];
-                    data::data_expression t1 = a.has_time() ? a.time() : t;
-                    state s1_at_t1 = make_timed_state(s1, t1);
-                    j = discovered.insert(std::make_pair(s1_at_t1, k)).first;
-                    discover_state(s1_at_t1, k);
+                    discover_state(s1_at_t1, k.first);
                     todo->insert(s1_at_t1);
                   }
-                  else
+                  examine_transition(s, s_index, a, s1, k.first, summand.index);
+                }
+                else
+                {
+                  std::pair<std::size_t, bool> k = discovered.insert(s1);
+                  if (k.second)
                   {
-                    j = discovered.insert(std::make_pair(s1, k)).first;
-                    discover_state(s1, k);
+                    discover_state(s1, k.first);
                     todo->insert(s1);
                   }
+                  examine_transition(s, s_index, a, s1, k.first, summand.index);
                 }
-                std::size_t s1_index = j->second;
-                examine_transition(s, s_index, a, s1, s1_index, summand.index);
               }
             }
           );
@@ -1274,7 +1271,7 @@ class explorer: public abortable
     }
 
     /// \brief Returns a mapping containing all discovered states.
-    const std::unordered_map<state, std::size_t>& state_map() const
+    const utilities::indexed_set<state>& state_map() const
     {
       return m_discovered;
     }
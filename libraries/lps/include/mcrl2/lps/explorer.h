@@ -12,29 +12,40 @@
 #ifndef MCRL2_LPS_EXPLORER_H
 #define MCRL2_LPS_EXPLORER_H
 
+#include <atomic>
 #include <deque>
+#include <exception>
 #include <iomanip>
 #include <limits>
+#include <memory>
 #include <random>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <boost/dynamic_bitset.hpp>
+#include "mcrl2/atermpp/thread_aterm_pool.h"
 #include "mcrl2/data/consistency.h"
 #include "mcrl2/data/enumerator.h"
 #include "mcrl2/data/substitution_utility.h"
 #include "mcrl2/lps/detail/instantiate_global_variables.h"
+#include "mcrl2/lps/detail/read_write_sets.h"
 #include "mcrl2/lps/explorer_options.h"
+#include "mcrl2/lps/hashed_state_set.h"
 #include "mcrl2/lps/one_point_rule_rewrite.h"
 #include "mcrl2/lps/order_summand_variables.h"
+#include "mcrl2/lps/partial_order_reduction.h"
 #include "mcrl2/lps/replace_constants_by_variables.h"
 #include "mcrl2/lps/resolve_name_clashes.h"
 #include "mcrl2/lps/state.h"
 #include "mcrl2/lps/specification.h"
 #include "mcrl2/lps/stochastic_state.h"
+#include "mcrl2/lps/tree_compressed_state_set.h"
 #include "mcrl2/process/timed_multi_action.h"
 #include "mcrl2/utilities/detail/container_utility.h"
 #include "mcrl2/utilities/detail/io.h"
+#include "mcrl2/utilities/indexed_set.h"
 #include "mcrl2/utilities/skip.h"
 #include "mcrl2/utilities/unused.h"
 
@@ -359,11 +370,78 @@ class explorer: public abortable
 
     // N.B. The keys are stored in term_appl instead of data_expression_list for performance reasons.
     std::unordered_map<atermpp::term_appl<data::data_expression>, std::list<data::data_expression_list>> global_cache;
-    std::unordered_map<state, std::size_t> m_discovered;
+    utilities::indexed_set<state> m_discovered;
+    tree_compressed_state_set m_compressed_discovered;
+    hash_compacted_state_set m_hash_compacted_discovered;
+    std::unique_ptr<bit_hashed_state_set> m_bit_hashed_discovered; // only allocated if bit hashing is enabled
 
     // used by make_timed_state, to avoid needless creation of vectors
     std::vector<data::data_expression> timed_state;
 
+    // Explorers with their own rewriter, enumerator and substitution, which are used by the additional threads
+    // of a multi-threaded exploration. Only the main explorer owns workers.
+    std::vector<std::unique_ptr<explorer>> m_workers;
+
+    // The outgoing transitions of a state, as computed by one of the threads of a multi-threaded exploration.
+    struct explored_state
+    {
+      state s;
+      std::vector<std::tuple<process::timed_multi_action, state, std::size_t>> transitions;
+      std::exception_ptr error;
+
+      explicit explored_state(const state& s_)
+        : s(s_)
+      {}
+    };
+
+    // The states that are explored in one round of a multi-threaded exploration. This is a member, such that the
+    // states that are passed to the callbacks outlive an exception that is thrown during exploration.
+    std::vector<explored_state> m_explored_states;
+
+    // Stubborn sets of the regular summands, if partial order reduction is enabled.
+    std::unique_ptr<partial_order_reduction> m_partial_order_reduction;
+
+    // For every summand k, the summands of which the condition does not depend on the parameters that are changed
+    // by a transition of k. This is only computed if incremental guard evaluation is enabled.
+    std::vector<boost::dynamic_bitset<>> m_preserved_disabled;
+
+    // For discovered states that have not been explored yet, the summands that are known to be disabled.
+    std::unordered_map<std::size_t, boost::dynamic_bitset<>> m_known_disabled;
+
+    // Computes m_preserved_disabled. Since a transition of a regular summand is followed by confluent transitions,
+    // the parameters that are changed by a confluent summand are changed by every regular summand.
+    void compute_preserved_disabled(std::size_t summand_count)
+    {
+      using utilities::detail::has_empty_intersection;
+
+      detail::parameter_positions positions(m_process_parameters);
+      std::vector<std::set<std::size_t>> Ts(summand_count);
+      std::vector<std::set<std::size_t>> Ws(summand_count);
+      std::set<std::size_t> confluent_Ws;
+      for (const explorer_summand& summand: m_regular_summands)
+      {
+        detail::read_write_sets sets = detail::compute_read_write_sets(summand, m_process_parameters, positions);
+        Ts[summand.index] = sets.Ts;
+        Ws[summand.index] = sets.Ws;
+      }
+      for (const explorer_summand& summand: m_confluent_summands)
+      {
+        detail::read_write_sets sets = detail::compute_read_write_sets(summand, m_process_parameters, positions);
+        Ts[summand.index] = sets.Ts;
+        confluent_Ws.insert(sets.Ws.begin(), sets.Ws.end());
+      }
+
+      m_preserved_disabled.assign(summand_count, boost::dynamic_bitset<>(summand_count));
+      for (std::size_t k = 0; k < summand_count; k++)
+      {
+        Ws[k].insert(confluent_Ws.begin(), confluent_Ws.end());
+        for (std::size_t j = 0; j < summand_count; j++)
+        {
+          m_preserved_disabled[k][j] = has_empty_intersection(Ts[j], Ws[k]);
+        }
+      }
+    }
+
     template <typename Specification>
     Specification preprocess(const Specification& lpsspec)
     {
@@ -705,6 +783,37 @@ class explorer: public abortable
       }
     }
 
+    // Returns true if the summand has an outgoing transition. A condition that cannot be rewritten to true or
+    // false is considered to be enabled; the error is then reported when its transitions are generated.
+    // It is assumed that the substitution sigma contains the assignments corresponding to the current state.
+    bool is_enabled(const explorer_summand& summand)
+    {
+      if (!m_recursive)
+      {
+        m_id_generator.clear();
+      }
+      data::data_expression condition = m_rewr(summand.condition, m_sigma);
+      if (data::is_false(condition))
+      {
+        return false;
+      }
+      if (summand.variables.empty())
+      {
+        return true;
+      }
+      bool result = false;
+      m_enumerator.enumerate(enumerator_element(summand.variables, condition),
+                  m_sigma,
+                  [&](const enumerator_element&) {
+                    result = true;
+                    return true;
+                  },
+                  data::is_false
+      );
+      data::remove_assignments(m_sigma, summand.variables);
+      return result;
+    }
+
     // pre: d0 is in normal form
     template <typename SummandSequence>
     std::vector<state> generate_successors(
@@ -767,9 +876,8 @@ class explorer: public abortable
       }
     }
 
-  public:
     template <typename Specification>
-    explorer(const Specification& lpsspec, const explorer_options& options_)
+    explorer(const Specification& lpsspec, const explorer_options& options_, bool is_worker)
       : m_options(options_),
         m_rewr(lpsspec.data(),
           data::used_data_equation_selector(lpsspec.data(), add_real_operators(lps::find_function_symbols(lpsspec)), lpsspec.global_variables()),
@@ -798,12 +906,124 @@ class explorer: public abortable
           m_regular_summands.emplace_back(summand, i, lpsspec_.process().process_parameters(), cache_strategy);
         }
       }
+
+      if (!is_worker && m_options.partial_order_reduction)
+      {
+        if (!m_confluent_summands.empty())
+        {
+          throw mcrl2::runtime_error("Partial order reduction cannot be combined with confluence reduction.");
+        }
+        m_partial_order_reduction.reset(new partial_order_reduction(m_regular_summands, m_process_parameters, m_options.visible_actions));
+      }
+
+      if (!is_worker && m_options.bit_hashing)
+      {
+        m_bit_hashed_discovered.reset(new bit_hashed_state_set(m_options.bit_hash_size, m_options.number_of_hash_functions));
+      }
+
+      // The indices of a hashed state set do not identify states, hence they cannot be used to pass on the
+      // disabled summands of a state.
+      if (!is_worker && m_options.incremental_guard_evaluation && !m_options.bit_hashing && !m_options.hash_compaction)
+      {
+        compute_preserved_disabled(lpsspec_summands.size());
+      }
+
+      if (!is_worker && m_options.number_of_threads > 1)
+      {
+        if (atermpp::detail::GlobalThreadSafe)
+        {
+          for (std::size_t i = 1; i < m_options.number_of_threads; i++)
+          {
+            m_workers.emplace_back(new explorer(lpsspec, options_, true));
+          }
+        }
+        else
+        {
+          mCRL2log(log::warning) << "Multi-threaded exploration requires a toolset that is built with MCRL2_ENABLE_MULTITHREADING; using one thread." << std::endl;
+        }
+      }
+    }
+
+    // Computes the outgoing transitions of x.s. An exception is stored in x.error, such that it can be rethrown
+    // by the main thread.
+    void explore_state(explored_state& x)
+    {
+      try
+      {
+        data::add_assignments(m_sigma, m_process_parameters, x.s);
+        for (const explorer_summand& summand: m_regular_summands)
+        {
+          generate_transitions(
+            summand,
+            m_confluent_summands,
+            [&](const process::timed_multi_action& a, const state& s1)
+            {
+              x.transitions.emplace_back(a, s1, summand.index);
+            }
+          );
+        }
+      }
+      catch (...)
+      {
+        x.error = std::current_exception();
+      }
+    }
+
+    // Computes the outgoing transitions of the states in todo, using this explorer and all workers. States are
+    // handed out in order, and threads stop taking new states once an error has occurred. Hence all states before
+    // the first failing one have been explored when this function returns.
+    void explore_states(std::vector<explored_state>& todo)
+    {
+      std::atomic<std::size_t> next(0);
+      std::atomic<bool> failed(false);
+      auto explore = [&](explorer& e)
+      {
+        while (!failed)
+        {
+          std::size_t i = next++;
+          if (i >= todo.size())
+          {
+            break;
+          }
+          e.explore_state(todo[i]);
+          if (todo[i].error)
+          {
+            failed = true;
+          }
+        }
+      };
+
+      std::vector<std::thread> threads;
+      for (std::size_t i = 0; i < m_workers.size() && i + 1 < todo.size(); i++)
+      {
+        explorer* worker = m_workers[i].get();
+        threads.emplace_back([&explore, worker]()
+          {
+            atermpp::thread_aterm_pool_registration registration;
+            explore(*worker);
+          }
+        );
+      }
+      explore(*this);
+
+      atermpp::thread_aterm_pool_idle idle;
+      for (std::thread& thread: threads)
+      {
+        thread.join();
+      }
     }
 
+  public:
+    template <typename Specification>
+    explorer(const Specification& lpsspec, const explorer_options& options_)
+      : explorer(lpsspec, options_, false)
+    {}
+
     ~explorer() = default;
 
     // pre: d0 is in normal form
     template <typename SummandSequence,
+      typename StateSet,
       typename DiscoverState = utilities::skip,
       typename ExamineTransition = utilities::skip,
       typename StartState = utilities::skip,
@@ -814,7 +1034,7 @@ class explorer: public abortable
       const state& d0,
       const SummandSequence& regular_summands,
       const SummandSequence& confluent_summands,
-      std::unordered_map<state, std::size_t>& discovered,
+      StateSet& discovered,
       DiscoverState discover_state = DiscoverState(),
       ExamineTransition examine_transition = ExamineTransition(),
       StartState start_state = StartState(),
@@ -824,39 +1044,268 @@ class explorer: public abortable
       m_recursive = recursive;
       std::unique_ptr<todo_set> todo = make_todo_set(d0);
       discovered.clear();
-      std::size_t d0_index = 0;
-      discovered.insert(std::make_pair(d0, d0_index));
+      std::size_t d0_index = discovered.insert(d0).first;
       discover_state(d0, d0_index);
 
+      // Incremental guard evaluation: the summands that are disabled in a state remain disabled in a successor, as
+      // long as the transition does not change a parameter of their condition.
+      bool incremental = !m_preserved_disabled.empty();
+      boost::dynamic_bitset<> disabled(m_preserved_disabled.size());
+      std::vector<std::pair<std::size_t, std::size_t>> discovered_successors; // (state index, summand index)
+      std::size_t guard_count = 0;
+      std::size_t skipped_guard_count = 0;
+      m_known_disabled.clear();
+
       while (!todo->empty() && !m_must_abort)
       {
         state s = todo->choose_element();
-        std::size_t s_index = discovered.find(s)->second;
+        std::size_t s_index = discovered.index(s);
         start_state(s, s_index);
         data::add_assignments(m_sigma, m_process_parameters, s);
+        if (incremental)
+        {
+          auto i = m_known_disabled.find(s_index);
+          if (i == m_known_disabled.end())
+          {
+            disabled.reset();
+          }
+          else
+          {
+            disabled = i->second;
+            m_known_disabled.erase(i);
+          }
+          discovered_successors.clear();
+        }
         for (const explorer_summand& summand: regular_summands)
         {
+          guard_count++;
+          if (incremental && disabled[summand.index])
+          {
+            skipped_guard_count++;
+            continue;
+          }
+          bool is_enabled = false;
           generate_transitions(
             summand,
             confluent_summands,
             [&](const process::timed_multi_action& a, const state& s1)
             {
-              auto j = discovered.find(s1);
-              if (j == discovered.end())
+              is_enabled = true;
+              std::pair<std::size_t, bool> k = discovered.insert(s1);
+              if (k.second)
               {
-                std::size_t k = discovered.size();
-                j = discovered.insert(std::make_pair(s1, k)).first;
-                discover_state(s1, k);
+                discover_state(s1, k.first);
                 todo->insert(s1);
+                if (incremental)
+                {
+                  discovered_successors.emplace_back(k.first, summand.index);
+                }
               }
-              std::size_t s1_index = j->second;
-              examine_transition(s, s_index, a, s1, s1_index, summand.index);
+              examine_transition(s, s_index, a, s1, k.first, summand.index);
             }
           );
+          if (incremental && !is_enabled)
+          {
+            disabled.set(summand.index);
+          }
+        }
+        if (incremental)
+        {
+          for (const auto& p: discovered_successors)
+          {
+            boost::dynamic_bitset<> successor_disabled = disabled & m_preserved_disabled[p.second];
+            if (successor_disabled.any())
+            {
+              m_known_disabled[p.first] = std::move(successor_disabled);
+            }
+          }
         }
         finish_state(s, s_index, todo->size());
         todo->finish_state();
       }
+      if (incremental)
+      {
+        m_known_disabled.clear();
+        mCRL2log(log::verbose) << "incremental guard evaluation: skipped " << skipped_guard_count << " of " << guard_count << " guard evaluations" << std::endl;
+      }
+      m_must_abort = false;
+    }
+
+    // Exploration in which only the enabled summands of a stubborn set are explored in every state. If the traces
+    // of visible actions must be preserved, a state is fully explored if one of the explored transitions leads
+    // to a state that was discovered before. Since every cycle is closed by such a transition, no transition is
+    // postponed forever (the cycle proviso).
+    // pre: d0 is in normal form
+    template <typename StateSet,
+      typename DiscoverState = utilities::skip,
+      typename ExamineTransition = utilities::skip,
+      typename StartState = utilities::skip,
+      typename FinishState = utilities::skip
+    >
+    void generate_untimed_state_space_reduced(
+      bool recursive,
+      const state& d0,
+      StateSet& discovered,
+      DiscoverState discover_state = DiscoverState(),
+      ExamineTransition examine_transition = ExamineTransition(),
+      StartState start_state = StartState(),
+      FinishState finish_state = FinishState()
+    )
+    {
+      m_recursive = recursive;
+      partial_order_reduction& por = *m_partial_order_reduction;
+      std::unique_ptr<todo_set> todo = make_todo_set(d0);
+      discovered.clear();
+      std::size_t d0_index = discovered.insert(d0).first;
+      discover_state(d0, d0_index);
+
+      const std::size_t N = m_regular_summands.size();
+      std::vector<bool> enabled(N);
+      std::size_t number_of_enabled_summands = 0;
+      std::size_t number_of_explored_summands = 0;
+      std::size_t number_of_fully_explored_states = 0;
+
+      auto conjunct_is_false = [&](const data::data_expression& x)
+      {
+        return data::is_false(m_rewr(x, m_sigma));
+      };
+
+      while (!todo->empty() && !m_must_abort)
+      {
+        state s = todo->choose_element();
+        std::size_t s_index = discovered.index(s);
+        start_state(s, s_index);
+        data::add_assignments(m_sigma, m_process_parameters, s);
+
+        std::size_t number_of_enabled = 0;
+        for (std::size_t k = 0; k < N; k++)
+        {
+          enabled[k] = is_enabled(m_regular_summands[k]);
+          number_of_enabled += enabled[k] ? 1 : 0;
+        }
+        std::vector<std::size_t> K = por.stubborn_set(enabled, conjunct_is_false);
+        number_of_enabled_summands += number_of_enabled;
+
+        bool fully_explore = false;
+        auto generate = [&](std::size_t i)
+        {
+          const explorer_summand& summand = m_regular_summands[i];
+          generate_transitions(
+            summand,
+            m_confluent_summands,
+            [&](const process::timed_multi_action& a, const state& s1)
+            {
+              std::pair<std::size_t, bool> k = discovered.insert(s1);
+              if (k.second)
+              {
+                discover_state(s1, k.first);
+                todo->insert(s1);
+              }
+              else if (por.preserves_visible_actions())
+              {
+                fully_explore = true;
+              }
+              examine_transition(s, s_index, a, s1, k.first, summand.index);
+            }
+          );
+        };
+
+        for (std::size_t k: K)
+        {
+          generate(k);
+        }
+        number_of_explored_summands += K.size();
+
+        if (fully_explore && K.size() < number_of_enabled)
+        {
+          number_of_fully_explored_states++;
+          number_of_explored_summands += number_of_enabled - K.size();
+          for (std::size_t k = 0; k < N; k++)
+          {
+            if (enabled[k] && !std::binary_search(K.begin(), K.end(), k))
+            {
+              generate(k);
+            }
+          }
+        }
+
+        finish_state(s, s_index, todo->size());
+        todo->finish_state();
+      }
+      m_must_abort = false;
+
+      mCRL2log(log::verbose) << "partial order reduction: explored " << number_of_explored_summands << " of "
+                             << number_of_enabled_summands << " enabled summands ("
+                             << std::setprecision(3) << (number_of_enabled_summands == 0 ? 100.0 : (100.0 * number_of_explored_summands) / number_of_enabled_summands)
+                             << "%), " << number_of_fully_explored_states << " states were fully explored due to the cycle proviso" << std::endl;
+    }
+
+    // Breadth-first exploration in which the outgoing transitions of consecutive states in the todo list are
+    // computed in parallel by the workers. The results are processed in the same order as in
+    // generate_untimed_state_space, hence the numbering of states and the order of the callbacks is the same.
+    // pre: d0 is in normal form
+    template <typename StateSet,
+      typename DiscoverState = utilities::skip,
+      typename ExamineTransition = utilities::skip,
+      typename StartState = utilities::skip,
+      typename FinishState = utilities::skip
+    >
+    void generate_untimed_state_space_parallel(
+      const state& d0,
+      StateSet& discovered,
+      DiscoverState discover_state = DiscoverState(),
+      ExamineTransition examine_transition = ExamineTransition(),
+      StartState start_state = StartState(),
+      FinishState finish_state = FinishState()
+    )
+    {
+      m_recursive = false;
+      for (std::unique_ptr<explorer>& worker: m_workers)
+      {
+        worker->m_recursive = false;
+      }
+      breadth_first_todo_set todo(d0);
+      discovered.clear();
+      std::size_t d0_index = discovered.insert(d0).first;
+      discover_state(d0, d0_index);
+
+      // The number of states that is explored in one parallel round.
+      const std::size_t chunk_size = 64 * (m_workers.size() + 1);
+      std::vector<explored_state>& chunk = m_explored_states;
+
+      while (!todo.empty() && !m_must_abort)
+      {
+        chunk.clear();
+        while (!todo.empty() && chunk.size() < chunk_size)
+        {
+          chunk.emplace_back(todo.choose_element());
+        }
+        explore_states(chunk);
+
+        for (std::size_t i = 0; i < chunk.size() && !m_must_abort; i++)
+        {
+          const state& s = chunk[i].s;
+          std::size_t s_index = discovered.index(s);
+          start_state(s, s_index);
+          for (const auto& transition: chunk[i].transitions)
+          {
+            const state& s1 = std::get<1>(transition);
+            std::pair<std::size_t, bool> k = discovered.insert(s1);
+            if (k.second)
+            {
+              discover_state(s1, k.first);
+              todo.insert(s1);
+            }
+            examine_transition(s, s_index, std::get<0>(transition), s1, k.first, std::get<2>(transition));
+          }
+          if (chunk[i].error)
+          {
+            std::rethrow_exception(chunk[i].error);
+          }
+          finish_state(s, s_index, todo.size() + chunk.size() - i - 1);
+          todo.finish_state();
+        }
+      }
       m_must_abort = false;
     }
 
@@ -870,6 +1319,7 @@ class explorer: public abortable
 
     // pre: d0 is in normal form
     template <typename SummandSequence,
+      typename StateSet,
       typename DiscoverState = utilities::skip,
       typename ExamineTransition = utilities::skip,
       typename StartState = utilities::skip,
@@ -880,7 +1330,7 @@ class explorer: public abortable
       bool recursive,
       const stochastic_state& s0_,
       const SummandSequence& regular_summands,
-      std::unordered_map<state, std::size_t>& discovered,
+      StateSet& discovered,
       DiscoverState discover_state = DiscoverState(),
       ExamineTransition examine_transition = ExamineTransition(),
       StartState start_state = StartState(),
@@ -895,17 +1345,19 @@ class explorer: public abortable
       std::list<std::size_t> s0_index;
       for (const state& s: S)
       {
-        std::size_t s_index = discovered.size();
-        discovered.insert(std::make_pair(s, s_index));
-        discover_state(s, s_index);
-        s0_index.push_back(s_index);
+        std::pair<std::size_t, bool> k = discovered.insert(s);
+        if (k.second)
+        {
+          discover_state(s, k.first);
+        }
+        s0_index.push_back(k.first);
       }
       discover_initial_state(s0_, s0_index);
 
       while (!todo->empty() && !m_must_abort)
       {
         state s = todo->choose_element();
-        std::size_t s_index = discovered.find(s)->second;
+        std::size_t s_index = discovered.index(s);
         start_state(s, s_index);
         data::add_assignments(m_sigma, m_process_parameters, s);
         for (const explorer_summand& summand: regular_summands)
@@ -918,15 +1370,13 @@ class explorer: public abortable
               const auto& S1 = s1_.states;
               for (const state& s1: S1)
               {
-                auto j = discovered.find(s1);
-                if (j == discovered.end())
+                std::pair<std::size_t, bool> k = discovered.insert(s1);
+                if (k.second)
                 {
                   todo->insert(s1);
-                  std::size_t k = discovered.size();
-                  j = discovered.insert(std::make_pair(s1, k)).first;
-                  discover_state(s1, k);
+                  discover_state(s1, k.first);
                 }
-                s1_index.push_back(j->second);
+                s1_index.push_back(k.first);
               }
               examine_transition(s, s_index, a, s1_, s1_index, summand.index);
             }
@@ -940,6 +1390,7 @@ class explorer: public abortable
 
     // pre: d0 is a timed state in normal form
     template <typename SummandSequence,
+      typename StateSet,
       typename DiscoverState = utilities::skip,
       typename ExamineTransition = utilities::skip,
       typename StartState = utilities::skip,
@@ -950,7 +1401,7 @@ class explorer: public abortable
       const state& d0,
       const SummandSequence& regular_summands,
       const SummandSequence& confluent_summands,
-      std::unordered_map<state, std::size_t>& discovered,
+      StateSet& discovered,
       DiscoverState discover_state = DiscoverState(),
       ExamineTransition examine_transition = ExamineTransition(),
       StartState start_state = StartState(),
@@ -960,15 +1411,14 @@ class explorer: public abortable
       m_recursive = recursive;
       std::unique_ptr<todo_set> todo = make_todo_set(d0);
       discovered.clear();
-      std::size_t d0_index = 0;
-      discovered.insert(std::make_pair(d0, d0_index));
+      std::size_t d0_index = discovered.insert(d0).first;
       discover_state(d0, d0_index);
 
       while (!todo->empty() && !m_must_abort)
       {
         state s_at_t = todo->choose_element();
         const data::data_expression& t = s_at_t[m_n];
-        std::size_t s_index = discovered.find(s_at_t)->second;
+        std::size_t s_index = discovered.index(s_at_t);
         start_state(s_at_t, s_index);
         data::add_assignments(m_sigma, m_process_parameters, s_at_t);
         for (const explorer_summand& summand: regular_summands)
@@ -983,17 +1433,14 @@ class explorer: public abortable
                 return;
               }
               data::data_expression t1 = a.has_time() ? a.time() : t;
-              auto j = discovered.find(s1);
-              if (j == discovered.end())
+              state s1_at_t1 = make_timed_state(s1, t1);
+              std::pair<std::size_t, bool> k = discovered.insert(s1_at_t1);
+              if (k.second)
               {
-                state s1_at_t1 = make_timed_state(s1, t1);
-                std::size_t k = discovered.size();
-                j = discovered.insert(std::make_pair(s1_at_t1, k)).first;
-                discover_state(s1_at_t1, k);
+                discover_state(s1_at_t1, k.first);
                 todo->insert(s1_at_t1);
               }
-              std::size_t s1_index = j->second;
-              examine_transition(s_at_t, s_index, a, j->first, s1_index, summand.index);
+              examine_transition(s_at_t, s_index, a, s1_at_t1, k.first, summand.index);
             }
           );
         }
@@ -1004,6 +1451,7 @@ class explorer: public abortable
 
     // pre: d0 is in normal form
     template <typename SummandSequence,
+      typename StateSet,
       typename DiscoverState = utilities::skip,
       typename ExamineTransition = utilities::skip,
       typename StartState = utilities::skip,
@@ -1015,7 +1463,7 @@ class explorer: public abortable
       const state& d0,
       const SummandSequence& regular_summands,
       const SummandSequence& confluent_summands,
-      std::unordered_map<state, std::size_t>& discovered,
+      StateSet& discovered,
       DiscoverState discover_state = DiscoverState(),
       ExamineTransition examine_transition = ExamineTransition(),
       StartState start_state = StartState(),
@@ -1032,6 +1480,66 @@ class explorer: public abortable
       }
     }
 
+    // Explores the state space from d0 with the algorithm that is selected by the options, and stores the
+    // discovered states in discovered.
+    // pre: d0 is in normal form
+    template <typename StateSet,
+      typename DiscoverState = utilities::skip,
+      typename ExamineTransition = utilities::skip,
+      typename StartState = utilities::skip,
+      typename FinishState = utilities::skip
+    >
+    void generate_state_space(
+      bool timed,
+      bool recursive,
+      const state& d0,
+      StateSet& discovered,
+      DiscoverState discover_state = DiscoverState(),
+      ExamineTransition examine_transition = ExamineTransition(),
+      StartState start_state = StartState(),
+      FinishState finish_state = FinishState()
+    )
+    {
+      bool reduced = m_partial_order_reduction && !timed;
+      bool parallel = !m_workers.empty() && !timed && !recursive && m_options.search_strategy == lps::es_breadth && !reduced;
+      if (reduced)
+      {
+        generate_untimed_state_space_reduced(recursive, d0, discovered, discover_state, examine_transition, start_state, finish_state);
+      }
+      else if (parallel)
+      {
+        generate_untimed_state_space_parallel(d0, discovered, discover_state, examine_transition, start_state, finish_state);
+      }
+      else
+      {
+        generate_state_space(timed, recursive, d0, m_regular_summands, m_confluent_summands, discovered, discover_state, examine_transition, start_state, finish_state);
+      }
+    }
+
+    void clear_discovered_states()
+    {
+      m_discovered.clear();
+      m_compressed_discovered.clear();
+      m_hash_compacted_discovered.clear();
+      if (m_bit_hashed_discovered)
+      {
+        m_bit_hashed_discovered->clear();
+      }
+    }
+
+    void report_omissions(const bit_hashed_state_set& discovered) const
+    {
+      mCRL2log(log::info) << "bit hashing: " << std::setprecision(3) << (100.0 * discovered.fill_ratio())
+                          << "% of the bits is set, the expected number of missed states is " << discovered.expected_omissions()
+                          << ", and the probability that a state was missed is " << discovered.omission_probability() << std::endl;
+    }
+
+    void report_omissions(const hash_compacted_state_set& discovered) const
+    {
+      mCRL2log(log::info) << "hash compaction: the expected number of missed states is " << std::setprecision(3) << discovered.expected_omissions()
+                          << ", and the probability that a state was missed is " << discovered.omission_probability() << std::endl;
+    }
+
     /// \brief Generates the state space, and reports all discovered states and transitions by means of callback
     /// functions.
     /// \param discover_state Is invoked when a state is encountered for the first time.
@@ -1062,7 +1570,29 @@ class explorer: public abortable
       {
         d0 = make_timed_state(d0, real_zero());
       }
-      generate_state_space(timed, recursive, d0, m_regular_summands, m_confluent_summands, m_discovered, discover_state, examine_transition, start_state, finish_state);
+      if (m_partial_order_reduction && timed)
+      {
+        mCRL2log(log::warning) << "Partial order reduction is not supported for timed exploration; it is ignored." << std::endl;
+      }
+      clear_discovered_states();
+      if (m_options.bit_hashing)
+      {
+        generate_state_space(timed, recursive, d0, *m_bit_hashed_discovered, discover_state, examine_transition, start_state, finish_state);
+        report_omissions(*m_bit_hashed_discovered);
+      }
+      else if (m_options.hash_compaction)
+      {
+        generate_state_space(timed, recursive, d0, m_hash_compacted_discovered, discover_state, examine_transition, start_state, finish_state);
+        report_omissions(m_hash_compacted_discovered);
+      }
+      else if (m_options.tree_compression)
+      {
+        generate_state_space(timed, recursive, d0, m_compressed_discovered, discover_state, examine_transition, start_state, finish_state);
+      }
+      else
+      {
+        generate_state_space(timed, recursive, d0, m_discovered, discover_state, examine_transition, start_state, finish_state);
+      }
     }
 
     /// \brief Generates the state space, and reports all discovered states and transitions by means of callback
@@ -1088,7 +1618,25 @@ class explorer: public abortable
     )
     {
       lps::stochastic_state d0 = compute_stochastic_state(m_initial_distribution, m_initial_state);
-      generate_untimed_stochastic_state_space(recursive, d0, m_regular_summands, m_discovered, discover_state, examine_transition, start_state, finish_state, discover_initial_state);
+      clear_discovered_states();
+      if (m_options.bit_hashing)
+      {
+        generate_untimed_stochastic_state_space(recursive, d0, m_regular_summands, *m_bit_hashed_discovered, discover_state, examine_transition, start_state, finish_state, discover_initial_state);
+        report_omissions(*m_bit_hashed_discovered);
+      }
+      else if (m_options.hash_compaction)
+      {
+        generate_untimed_stochastic_state_space(recursive, d0, m_regular_summands, m_hash_compacted_discovered, discover_state, examine_transition, start_state, finish_state, discover_initial_state);
+        report_omissions(m_hash_compacted_discovered);
+      }
+      else if (m_options.tree_compression)
+      {
+        generate_untimed_stochastic_state_space(recursive, d0, m_regular_summands, m_compressed_discovered, discover_state, examine_transition, start_state, finish_state, discover_initial_state);
+      }
+      else
+      {
+        generate_untimed_stochastic_state_space(recursive, d0, m_regular_summands, m_discovered, discover_state, examine_transition, start_state, finish_state, discover_initial_state);
+      }
     }
 
     /// \brief Generates outgoing transitions for a given state.
@@ -1146,10 +1694,30 @@ class explorer: public abortable
       m_must_abort = true;
     }
 
-    /// \brief Returns a mapping containing all discovered states.
-    const std::unordered_map<state, std::size_t>& state_map() const
+    /// \brief Returns the number of discovered states.
+    /// \details If bit hashing is enabled, this is the number of state indices that have been handed out.
+    std::size_t number_of_states() const
     {
-      return m_discovered;
+      if (m_options.bit_hashing)
+      {
+        return m_bit_hashed_discovered->size();
+      }
+      else if (m_options.hash_compaction)
+      {
+        return m_hash_compacted_discovered.size();
+      }
+      return m_options.tree_compression ? m_compressed_discovered.size() : m_discovered.size();
+    }
+
+    /// \brief Returns the discovered state with index i.
+    /// \pre Neither bit hashing nor hash compaction is enabled, since then the states are not stored.
+    state discovered_state(std::size_t i) const
+    {
+      if (m_options.bit_hashing || m_options.hash_compaction)
+      {
+        throw mcrl2::runtime_error("The discovered states are not available when bit hashing or hash compaction is used.");
+      }
+      return m_options.tree_compression ? m_compressed_discovered[i] : m_discovered[i];
     }
 
     const std::vector<explorer_summand>& regular_summands() const
@@ -41,15 +41,24 @@ struct explorer_options
   bool suppress_progress_messages = false;
   bool no_store = false;
   bool dfs_recursive = false;
+  bool tree_compression = false;
+  bool partial_order_reduction = false;
+  bool incremental_guard_evaluation = false;
+  bool bit_hashing = false;
+  bool hash_compaction = false;
   std::size_t max_states = std::numeric_limits<std::size_t>::max();
   std::size_t max_traces = 0;
   std::size_t todo_max = std::numeric_limits<std::size_t>::max();
+  std::size_t number_of_threads = 1;
+  std::size_t bit_hash_size = 200000000;
+  std::size_t number_of_hash_functions = 3;
   std::string priority_action;
   std::string trace_prefix;
   std::set<core::identifier_string> trace_actions;
   std::set<std::string> trace_multiaction_strings;
   std::set<lps::multi_action> trace_multiactions;
   std::set<core::identifier_string> actions_internal_for_divergencies;
+  std::set<core::identifier_string> visible_actions;
 };
 
 inline
@@ -72,15 +81,24 @@ std::ostream& operator<<(std::ostream& out, const explorer_options& options)
   out << "suppress-progress-messages = " << std::boolalpha << options.suppress_progress_messages << std::endl;
   out << "no-store = " << std::boolalpha << options.no_store << std::endl;
   out << "dfs-recursive = " << std::boolalpha << options.dfs_recursive << std::endl;
+  out << "tree-compression = " << std::boolalpha << options.tree_compression << std::endl;
+  out << "partial-order-reduction = " << std::boolalpha << options.partial_order_reduction << std::endl;
+  out << "incremental-guard-evaluation = " << std::boolalpha << options.incremental_guard_evaluation << std::endl;
+  out << "bit-hashing = " << std::boolalpha << options.bit_hashing << std::endl;
+  out << "hash-compaction = " << std::boolalpha << options.hash_compaction << std::endl;
   out << "max-states = " << options.max_states << std::endl;
   out << "max-traces = " << options.max_traces << std::endl;
   out << "todo-max = " << options.todo_max << std::endl;
+  out << "threads = " << options.number_of_threads << std::endl;
+  out << "bit-hash-size = " << options.bit_hash_size << std::endl;
+  out << "hash-functions = " << options.number_of_hash_functions << std::endl;
   out << "priority-action = " << options.priority_action << std::endl;
   out << "trace-prefix = " << options.trace_prefix << std::endl;
   out << "trace-actions = " << core::detail::print_set(options.trace_actions) << std::endl;
   out << "trace-multiaction-strings = " << core::detail::print_set(options.trace_multiaction_strings) << std::endl;
   out << "trace-multiactions = " << core::detail::print_set(options.trace_multiactions) << std::endl;
   out << "actions-internal-for-divergencies = " << core::detail::print_set(options.actions_internal_for_divergencies) << std::endl;
+  out << "visible-actions = " << core::detail::print_set(options.visible_actions) << std::endl;
   return out;
 }
 
@@ -0,0 +1,305 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/lps/hashed_state_set.h
+/// \brief Sets of states that only store hash values of the states, i.e. bit state hashing and hash compaction.
+
+#ifndef MCRL2_LPS_HASHED_STATE_SET_H
+#define MCRL2_LPS_HASHED_STATE_SET_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "mcrl2/atermpp/aterm_int.h"
+#include "mcrl2/data/function_symbol.h"
+#include "mcrl2/lps/state.h"
+#include "mcrl2/utilities/indexed_set.h"
+
+namespace mcrl2 {
+
+namespace lps {
+
+namespace detail {
+
+// The finalizer of the SplitMix64 generator, which is used to mix the bits of a hash value.
+inline
+std::uint64_t mix_bits(std::uint64_t x)
+{
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+inline
+std::uint64_t combine_fingerprints(std::uint64_t seed, std::uint64_t x)
+{
+  return mix_bits(seed * 0x9e3779b97f4a7c15ULL + x);
+}
+
+/// \brief Computes 64-bit fingerprints of states, that only depend on the structure of the states.
+/// \details The hash function of aterms is based on their address. Since the states in a hashed state set are not
+/// stored, their addresses may be reused by other states, hence it cannot be used to identify states.
+class state_fingerprint
+{
+  protected:
+    // The fingerprints of data function symbols, which are shared by many states.
+    std::unordered_map<atermpp::aterm, std::uint64_t> m_function_symbols;
+
+    std::uint64_t compute(const atermpp::aterm& x)
+    {
+      if (x.type_is_int())
+      {
+        return mix_bits(atermpp::down_cast<atermpp::aterm_int>(x).value() + 1);
+      }
+      if (x.type_is_list())
+      {
+        std::uint64_t result = 2;
+        for (const atermpp::aterm& y: atermpp::down_cast<atermpp::aterm_list>(x))
+        {
+          result = combine_fingerprints(result, compute(y));
+        }
+        return result;
+      }
+      const auto& x_ = atermpp::down_cast<atermpp::aterm_appl>(x);
+      if (data::is_function_symbol(x_))
+      {
+        auto i = m_function_symbols.find(x);
+        if (i != m_function_symbols.end())
+        {
+          return i->second;
+        }
+        std::uint64_t result = compute_appl(x_);
+        m_function_symbols.insert(std::make_pair(x, result));
+        return result;
+      }
+      return compute_appl(x_);
+    }
+
+    std::uint64_t compute_appl(const atermpp::aterm_appl& x)
+    {
+      std::uint64_t result = combine_fingerprints(std::hash<std::string>()(x.function().name()), x.function().arity());
+      for (const atermpp::aterm& y: x)
+      {
+        result = combine_fingerprints(result, compute(y));
+      }
+      return result;
+    }
+
+  public:
+    std::uint64_t operator()(const state& s)
+    {
+      std::uint64_t result = s.size();
+      for (const data::data_expression& x: s)
+      {
+        result = combine_fingerprints(result, compute(x));
+      }
+      return result;
+    }
+
+    void clear()
+    {
+      m_function_symbols.clear();
+    }
+};
+
+} // namespace detail
+
+/// \brief A set of states that is stored using bit state hashing.
+/// \details A state is represented by k positions in a table of bits, that are computed from its fingerprint
+/// using double hashing. A state is new if one of its bits is not yet set. This may cause states to be missed,
+/// if all their bits have been set by other states. This is the multi-hash bit state hashing of Holzmann.
+/// To assign an index to each state, the first bit position of every state is stored in an indexed set.
+/// States with the same first bit position share their index.
+class bit_hashed_state_set
+{
+  protected:
+    std::vector<bool> m_bits;
+    std::size_t m_number_of_hash_functions;
+    utilities::indexed_set<std::size_t> m_indices;
+    detail::state_fingerprint m_fingerprint;
+
+    // The number of bits that have been set.
+    std::size_t m_number_of_set_bits = 0;
+
+    // The sum of the probabilities that a new state would have been missed at the moment it was inserted.
+    double m_expected_omissions = 0.0;
+
+    // Used to avoid needless creation of vectors.
+    mutable std::vector<std::size_t> m_positions;
+
+    // Stores the bit positions of the state with fingerprint h in positions.
+    void compute_positions(std::uint64_t h, std::vector<std::size_t>& positions) const
+    {
+      std::uint64_t h1 = h;
+      std::uint64_t h2 = detail::mix_bits(h) | 1;
+      positions.clear();
+      for (std::size_t i = 0; i < m_number_of_hash_functions; i++)
+      {
+        positions.push_back((h1 + i * h2) % m_bits.size());
+      }
+    }
+
+  public:
+    /// \brief Value returned by index when a state does not exist in the set.
+    static const std::size_t npos = utilities::indexed_set<std::size_t>::npos;
+
+    /// \brief Constructor.
+    /// \param size The number of bits of the table.
+    /// \param number_of_hash_functions The number of bits that is set for every state.
+    bit_hashed_state_set(std::size_t size, std::size_t number_of_hash_functions)
+      : m_bits(std::max(size, std::size_t(1)), false), m_number_of_hash_functions(std::max(number_of_hash_functions, std::size_t(1)))
+    {}
+
+    /// \brief Inserts the state s, and returns its index together with a boolean that indicates whether
+    /// s was considered to be new.
+    std::pair<std::size_t, bool> insert(const state& s)
+    {
+      compute_positions(m_fingerprint(s), m_positions);
+      double fill = static_cast<double>(m_number_of_set_bits) / m_bits.size();
+      bool is_new = false;
+      for (std::size_t i: m_positions)
+      {
+        if (!m_bits[i])
+        {
+          m_bits[i] = true;
+          m_number_of_set_bits++;
+          is_new = true;
+        }
+      }
+      if (is_new)
+      {
+        m_expected_omissions += std::pow(fill, m_number_of_hash_functions);
+      }
+      return std::make_pair(m_indices.insert(m_positions.front()).first, is_new);
+    }
+
+    /// \brief Returns the index of the state s, or npos if it has not been inserted.
+    std::size_t index(const state& s) const
+    {
+      compute_positions(const_cast<bit_hashed_state_set&>(*this).m_fingerprint(s), m_positions);
+      for (std::size_t i: m_positions)
+      {
+        if (!m_bits[i])
+        {
+          return npos;
+        }
+      }
+      return m_indices.index(m_positions.front());
+    }
+
+    /// \brief Indicates whether the state s is in the set.
+    bool contains(const state& s) const
+    {
+      return index(s) != npos;
+    }
+
+    /// \brief Returns the number of indices that have been assigned to states.
+    std::size_t size() const
+    {
+      return m_indices.size();
+    }
+
+    /// \brief Removes all states from the set.
+    void clear()
+    {
+      m_bits.assign(m_bits.size(), false);
+      m_indices.clear();
+      m_fingerprint.clear();
+      m_number_of_set_bits = 0;
+      m_expected_omissions = 0.0;
+    }
+
+    /// \brief Returns an estimate of the number of reachable states that have been missed.
+    /// \details Every time a new state is inserted, the probability that it would have been missed is
+    /// f^k, with f the fraction of bits that was set at that moment, and k the number of hash functions.
+    double expected_omissions() const
+    {
+      return m_expected_omissions;
+    }
+
+    /// \brief Returns an estimate of the probability that at least one reachable state has been missed.
+    double omission_probability() const
+    {
+      return -std::expm1(-m_expected_omissions);
+    }
+
+    /// \brief Returns the fraction of bits that is set.
+    double fill_ratio() const
+    {
+      return static_cast<double>(m_number_of_set_bits) / m_bits.size();
+    }
+};
+
+/// \brief A set of states that is stored using hash compaction.
+/// \details A state is represented by a 64-bit fingerprint. Two different states with the same fingerprint are
+/// considered to be equal, hence states may be missed.
+class hash_compacted_state_set
+{
+  protected:
+    utilities::indexed_set<std::uint64_t> m_fingerprints;
+    detail::state_fingerprint m_fingerprint;
+
+  public:
+    /// \brief Value returned by index when a state does not exist in the set.
+    static const std::size_t npos = utilities::indexed_set<std::uint64_t>::npos;
+
+    /// \brief Inserts the state s, and returns its index together with a boolean that indicates whether
+    /// s was considered to be new.
+    std::pair<std::size_t, bool> insert(const state& s)
+    {
+      return m_fingerprints.insert(m_fingerprint(s));
+    }
+
+    /// \brief Returns the index of the state s, or npos if its fingerprint is not in the set.
+    std::size_t index(const state& s) const
+    {
+      return m_fingerprints.index(const_cast<hash_compacted_state_set&>(*this).m_fingerprint(s));
+    }
+
+    /// \brief Indicates whether the state s is in the set.
+    bool contains(const state& s) const
+    {
+      return index(s) != npos;
+    }
+
+    /// \brief Returns the number of states in the set.
+    std::size_t size() const
+    {
+      return m_fingerprints.size();
+    }
+
+    /// \brief Removes all states from the set.
+    void clear()
+    {
+      m_fingerprints.clear();
+      m_fingerprint.clear();
+    }
+
+    /// \brief Returns an estimate of the number of reachable states that have been missed.
+    /// \details For n states, the expected number of pairs of states with the same fingerprint is n(n-1)/2^65.
+    double expected_omissions() const
+    {
+      double n = static_cast<double>(size());
+      return n * (n - 1) / std::ldexp(1.0, 65);
+    }
+
+    /// \brief Returns an estimate of the probability that at least one reachable state has been missed.
+    double omission_probability() const
+    {
+      return -std::expm1(-expected_omissions());
+    }
+};
+
+} // namespace lps
+
+} // namespace mcrl2
+
+#endif // MCRL2_LPS_HASHED_STATE_SET_H
@@ -0,0 +1,301 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/lps/partial_order_reduction.h
+/// \brief Stubborn sets of summands, for partial order reduction during state space generation.
+
+#ifndef MCRL2_LPS_PARTIAL_ORDER_REDUCTION_H
+#define MCRL2_LPS_PARTIAL_ORDER_REDUCTION_H
+
+#include <algorithm>
+#include <limits>
+#include <set>
+#include <vector>
+#include "mcrl2/data/bool.h"
+#include "mcrl2/lps/detail/read_write_sets.h"
+
+namespace mcrl2 {
+
+namespace lps {
+
+namespace detail {
+
+// Splits x into a sequence of conjuncts, from left to right.
+inline
+void split_conjuncts(const data::data_expression& x, std::vector<data::data_expression>& result)
+{
+  if (data::sort_bool::is_and_application(x))
+  {
+    split_conjuncts(data::sort_bool::left(x), result);
+    split_conjuncts(data::sort_bool::right(x), result);
+  }
+  else
+  {
+    result.push_back(x);
+  }
+}
+
+} // namespace detail
+
+/// \brief Computes stubborn sets of summands of a linear process.
+/// \details The dependencies between summands are determined once, using the process parameters that
+/// summands test in their condition (Ts), write in their next state (Ws) and read in their next state,
+/// actions and time (Rs). Two summands are independent if neither of them writes a parameter that the other
+/// one tests, writes or reads. In that case they commute, and cannot disable each other. A summand that is
+/// disabled can only be enabled by a summand that writes a parameter of a conjunct of its condition that is
+/// false; these summands form the necessary enabling set of the conjunct.
+///
+/// In every state, a stubborn set is computed from a seed that is enabled. For an enabled summand all
+/// dependent summands are added, and for a disabled summand a necessary enabling set is added. Exploring
+/// only the enabled summands of the stubborn set preserves all deadlocks. If a set of visible summands is
+/// given, all visible summands are added as soon as an enabled visible summand is added. Together with the
+/// cycle proviso that is applied by the explorer, this also preserves the traces of visible actions.
+class partial_order_reduction
+{
+  protected:
+    struct guard_conjunct
+    {
+      data::data_expression expression;
+      std::vector<std::size_t> NES;
+    };
+
+    struct summand_info
+    {
+      std::vector<std::size_t> dependent;     // the summands that do not commute with this summand
+      std::vector<guard_conjunct> conjuncts;  // the conjuncts of the condition that depend on process parameters
+      std::vector<std::size_t> NES;           // the summands that write a parameter of the condition
+      bool is_visible = false;
+    };
+
+    std::vector<summand_info> m_summands;
+    std::vector<std::size_t> m_visible;
+
+    // Administration of a single stubborn set computation. For every conjunct it is recorded whether it is
+    // unknown (0), false (1) or not false (2) in the current state.
+    std::vector<bool> m_in_stubborn_set;
+    std::vector<std::vector<char>> m_conjunct_is_false;
+
+    static std::vector<std::size_t> writers(const std::vector<std::set<std::size_t>>& Ws, const std::set<std::size_t>& parameters)
+    {
+      std::vector<std::size_t> result;
+      for (std::size_t k = 0; k < Ws.size(); k++)
+      {
+        if (!utilities::detail::has_empty_intersection(Ws[k], parameters))
+        {
+          result.push_back(k);
+        }
+      }
+      return result;
+    }
+
+    // Returns a necessary enabling set of the disabled summand k. Among the conjuncts that are false, the one is
+    // chosen whose necessary enabling set adds the least number of enabled summands to the stubborn set.
+    template <typename ConjunctIsFalse>
+    const std::vector<std::size_t>& NES(std::size_t k, const std::vector<bool>& enabled, ConjunctIsFalse conjunct_is_false)
+    {
+      auto cost = [&](const std::vector<std::size_t>& NES)
+      {
+        return std::count_if(NES.begin(), NES.end(), [&](std::size_t k1) { return enabled[k1] && !m_in_stubborn_set[k1]; });
+      };
+
+      const summand_info& summand = m_summands[k];
+      const std::vector<std::size_t>* result = &summand.NES;
+      std::ptrdiff_t result_cost = cost(summand.NES);
+      for (std::size_t i = 0; i < summand.conjuncts.size() && result_cost > 0; i++)
+      {
+        const guard_conjunct& c = summand.conjuncts[i];
+        char& is_false = m_conjunct_is_false[k][i];
+        if (is_false == 0)
+        {
+          is_false = conjunct_is_false(c.expression) ? 1 : 2;
+        }
+        if (is_false == 1)
+        {
+          std::ptrdiff_t c_cost = cost(c.NES);
+          if (c_cost < result_cost)
+          {
+            result = &c.NES;
+            result_cost = c_cost;
+          }
+        }
+      }
+      return *result;
+    }
+
+    // Computes the enabled summands of the stubborn set that contains seed. The computation is abandoned as soon
+    // as it contains bound enabled summands.
+    template <typename ConjunctIsFalse>
+    std::vector<std::size_t> closure(std::size_t seed, const std::vector<bool>& enabled, std::size_t bound, ConjunctIsFalse conjunct_is_false)
+    {
+      std::vector<std::size_t> result;
+      std::vector<std::size_t> todo{ seed };
+      std::vector<std::size_t> added{ seed };
+      m_in_stubborn_set[seed] = true;
+      bool visible_added = false;
+
+      auto add = [&](std::size_t k)
+      {
+        if (!m_in_stubborn_set[k])
+        {
+          m_in_stubborn_set[k] = true;
+          todo.push_back(k);
+          added.push_back(k);
+        }
+      };
+
+      while (!todo.empty() && result.size() < bound)
+      {
+        std::size_t k = todo.back();
+        todo.pop_back();
+        if (enabled[k])
+        {
+          result.push_back(k);
+          for (std::size_t k1: m_summands[k].dependent)
+          {
+            add(k1);
+          }
+          if (m_summands[k].is_visible && !visible_added)
+          {
+            visible_added = true;
+            for (std::size_t k1: m_visible)
+            {
+              add(k1);
+            }
+          }
+        }
+        else
+        {
+          for (std::size_t k1: NES(k, enabled, conjunct_is_false))
+          {
+            add(k1);
+          }
+        }
+      }
+
+      for (std::size_t k: added)
+      {
+        m_in_stubborn_set[k] = false;
+      }
+      return result;
+    }
+
+  public:
+    /// \brief Constructor.
+    /// \param summands A sequence of summands with attributes variables, condition, multi_action and next_state.
+    /// \param process_parameters The process parameters.
+    /// \param visible_actions The names of the actions of which the traces must be preserved.
+    template <typename SummandSequence>
+    partial_order_reduction(const SummandSequence& summands,
+                            const std::vector<data::variable>& process_parameters,
+                            const std::set<core::identifier_string>& visible_actions = std::set<core::identifier_string>())
+    {
+      using utilities::detail::has_empty_intersection;
+
+      detail::parameter_positions positions(process_parameters);
+      std::size_t N = summands.size();
+      std::vector<std::set<std::size_t>> Ts(N);
+      std::vector<std::set<std::size_t>> Ws(N);
+      std::vector<std::set<std::size_t>> Vs(N);
+      std::vector<std::vector<data::data_expression>> conjuncts(N);
+      m_summands.resize(N);
+
+      std::size_t k = 0;
+      for (const auto& summand: summands)
+      {
+        detail::read_write_sets sets = detail::compute_read_write_sets(summand, process_parameters, positions);
+        Ts[k] = sets.Ts;
+        Ws[k] = sets.Ws;
+        Vs[k] = sets.Vs();
+        for (const process::action& a: summand.multi_action.actions())
+        {
+          if (visible_actions.find(a.label().name()) != visible_actions.end())
+          {
+            m_summands[k].is_visible = true;
+          }
+        }
+        detail::split_conjuncts(summand.condition, conjuncts[k]);
+        if (m_summands[k].is_visible)
+        {
+          m_visible.push_back(k);
+        }
+        k++;
+      }
+
+      for (std::size_t k = 0; k < N; k++)
+      {
+        summand_info& info = m_summands[k];
+        for (std::size_t k1 = 0; k1 < N; k1++)
+        {
+          if (k1 != k && (!has_empty_intersection(Ws[k], Vs[k1]) || !has_empty_intersection(Ws[k1], Vs[k])))
+          {
+            info.dependent.push_back(k1);
+          }
+        }
+        info.NES = writers(Ws, Ts[k]);
+        for (const data::data_expression& c: conjuncts[k])
+        {
+          std::set<std::size_t> P = positions(c);
+          if (!P.empty() && conjuncts[k].size() > 1)
+          {
+            info.conjuncts.push_back(guard_conjunct{c, writers(Ws, P)});
+          }
+        }
+      }
+
+      m_in_stubborn_set.resize(N, false);
+      m_conjunct_is_false.resize(N);
+      for (std::size_t k = 0; k < N; k++)
+      {
+        m_conjunct_is_false[k].resize(m_summands[k].conjuncts.size());
+      }
+    }
+
+    /// \brief Returns true if the traces of visible actions are preserved, in which case the explorer must
+    /// apply the cycle proviso.
+    bool preserves_visible_actions() const
+    {
+      return !m_visible.empty();
+    }
+
+    /// \brief Returns the enabled summands of a stubborn set in the current state, in increasing order.
+    /// \param enabled The summands that are enabled in the current state.
+    /// \param conjunct_is_false Is invoked on a conjunct of a condition to determine whether it is false in the
+    /// current state.
+    /// \details Every enabled summand is tried as a seed, and a stubborn set with the least number of enabled
+    /// summands is returned. If no summand is enabled, the result is empty.
+    template <typename ConjunctIsFalse>
+    std::vector<std::size_t> stubborn_set(const std::vector<bool>& enabled, ConjunctIsFalse conjunct_is_false)
+    {
+      for (std::vector<char>& v: m_conjunct_is_false)
+      {
+        std::fill(v.begin(), v.end(), 0);
+      }
+      std::vector<std::size_t> result;
+      std::size_t bound = std::numeric_limits<std::size_t>::max();
+      for (std::size_t k = 0; k < enabled.size() && bound > 1; k++)
+      {
+        if (enabled[k])
+        {
+          std::vector<std::size_t> K = closure(k, enabled, bound, conjunct_is_false);
+          if (K.size() < bound)
+          {
+            bound = K.size();
+            result = std::move(K);
+          }
+        }
+      }
+      std::sort(result.begin(), result.end());
+      return result;
+    }
+};
+
+} // namespace lps
+
+} // namespace mcrl2
+
+#endif // MCRL2_LPS_PARTIAL_ORDER_REDUCTION_H
@@ -0,0 +1,218 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/lps/tree_compressed_state_set.h
+/// \brief A set of states that is stored using tree compression.
+
+#ifndef MCRL2_LPS_TREE_COMPRESSED_STATE_SET_H
+#define MCRL2_LPS_TREE_COMPRESSED_STATE_SET_H
+
+#include <cassert>
+#include <utility>
+#include <vector>
+#include "mcrl2/lps/state.h"
+#include "mcrl2/utilities/hash_utility.h"
+#include "mcrl2/utilities/indexed_set.h"
+
+namespace mcrl2 {
+
+namespace lps {
+
+/// \brief A set of states that assigns each state a unique index, like utilities::indexed_set<state>.
+/// \details The values of each process parameter are stored in a separate indexed set. A state is represented
+/// by a binary tree with the indices of its parameter values at the leaves. Every internal node of this tree
+/// is a pair of indices, that is stored in an indexed set that belongs to the position of the node. The index
+/// of the root pair is the index of the state. States that differ in one parameter share all nodes except the
+/// ones on the path from that parameter to the root. This is the tree compression technique of LTSmin.
+/// The states themselves are not stored, hence the terms that represent them can be garbage collected.
+class tree_compressed_state_set
+{
+  protected:
+    typedef std::pair<std::size_t, std::size_t> node;
+
+    // The number of parameters of the stored states. It is determined by the first inserted state.
+    std::size_t m_width = 0;
+
+    // The values of the parameters.
+    std::vector<utilities::indexed_set<data::data_expression>> m_leaves;
+
+    // m_level_sizes[0] is the number of leaves. m_level_sizes[k + 1] is the number of nodes at level k + 1,
+    // which has a node for every two consecutive nodes at level k. If the number of nodes at level k is odd,
+    // the last one is passed on to level k + 1 without storing a pair. The last level has at most two nodes.
+    std::vector<std::size_t> m_level_sizes;
+
+    // m_nodes[k][j] contains the pairs of the node at position j of level k + 1.
+    std::vector<std::vector<utilities::indexed_set<node>>> m_nodes;
+
+    // The pairs of the roots, consisting of the one or two nodes at the last level.
+    utilities::indexed_set<node> m_roots;
+
+    // Used to avoid needless creation of vectors.
+    mutable std::vector<std::size_t> m_indices;
+    mutable std::vector<data::data_expression> m_values;
+
+    void initialize(std::size_t width)
+    {
+      m_width = width;
+      m_leaves = std::vector<utilities::indexed_set<data::data_expression>>(width);
+      m_level_sizes = { width };
+      while (m_level_sizes.back() > 2)
+      {
+        m_level_sizes.push_back((m_level_sizes.back() + 1) / 2);
+      }
+      m_nodes.clear();
+      for (std::size_t k = 1; k < m_level_sizes.size(); k++)
+      {
+        m_nodes.emplace_back(m_level_sizes[k - 1] / 2);
+      }
+    }
+
+    // Computes the index of the root pair of s, by inserting the nodes of s if Insert is true, and by looking
+    // them up otherwise. Returns utilities::indexed_set<node>::npos if Insert is false and s is not in the set.
+    // If Insert is false, only m_indices is modified.
+    template <bool Insert>
+    std::pair<std::size_t, bool> find_or_insert(const state& s)
+    {
+      const std::size_t npos = utilities::indexed_set<node>::npos;
+      m_indices.clear();
+      std::size_t i = 0;
+      for (const data::data_expression& x: s)
+      {
+        std::size_t index = Insert ? m_leaves[i].insert(x).first : m_leaves[i].index(x);
+        if (index == npos)
+        {
+          return std::make_pair(npos, false);
+        }
+        m_indices.push_back(index);
+        i++;
+      }
+
+      // Combine the nodes level by level, storing the nodes of the next level in the front of m_indices.
+      for (std::size_t k = 0; k + 1 < m_level_sizes.size(); k++)
+      {
+        std::size_t n = m_level_sizes[k];
+        for (std::size_t j = 0; j < n / 2; j++)
+        {
+          node p(m_indices[2 * j], m_indices[2 * j + 1]);
+          std::size_t index = Insert ? m_nodes[k][j].insert(p).first : m_nodes[k][j].index(p);
+          if (index == npos)
+          {
+            return std::make_pair(npos, false);
+          }
+          m_indices[j] = index;
+        }
+        if (n % 2 == 1)
+        {
+          m_indices[n / 2] = m_indices[n - 1];
+        }
+      }
+
+      std::size_t n = m_level_sizes.back();
+      node root(n > 0 ? m_indices[0] : 0, n > 1 ? m_indices[1] : 0);
+      if (Insert)
+      {
+        return m_roots.insert(root);
+      }
+      return std::make_pair(m_roots.index(root), false);
+    }
+
+    // Stores the parameter values of the node with the given index at position j of level k in m_values.
+    void expand(std::size_t k, std::size_t j, std::size_t index) const
+    {
+      if (k == 0)
+      {
+        m_values[j] = m_leaves[j][index];
+      }
+      else if (2 * j + 1 < m_level_sizes[k - 1])
+      {
+        const node& p = m_nodes[k - 1][j][index];
+        expand(k - 1, 2 * j, p.first);
+        expand(k - 1, 2 * j + 1, p.second);
+      }
+      else
+      {
+        expand(k - 1, 2 * j, index);
+      }
+    }
+
+  public:
+    /// \brief Value returned by index when a state does not exist in the set.
+    static const std::size_t npos = utilities::indexed_set<node>::npos;
+
+    tree_compressed_state_set()
+    {
+      initialize(0);
+    }
+
+    /// \brief Inserts the state s, and returns its index together with a boolean that indicates whether
+    /// s was actually inserted.
+    std::pair<std::size_t, bool> insert(const state& s)
+    {
+      if (m_roots.size() == 0 && m_width != s.size())
+      {
+        initialize(s.size());
+      }
+      assert(s.size() == m_width);
+      return find_or_insert<true>(s);
+    }
+
+    /// \brief Returns the index of the state s, or npos if it is not in the set.
+    std::size_t index(const state& s) const
+    {
+      if (s.size() != m_width)
+      {
+        return npos;
+      }
+      return const_cast<tree_compressed_state_set&>(*this).find_or_insert<false>(s).first;
+    }
+
+    /// \brief Indicates whether the state s is in the set.
+    bool contains(const state& s) const
+    {
+      return index(s) != npos;
+    }
+
+    /// \brief Returns the state with the given index.
+    /// \details The state is reconstructed from the stored parameter values.
+    state operator[](std::size_t i) const
+    {
+      assert(i < size());
+      m_values.resize(m_width);
+      const node& root = m_roots[i];
+      std::size_t k = m_level_sizes.size() - 1;
+      std::size_t n = m_level_sizes.back();
+      if (n > 0)
+      {
+        expand(k, 0, root.first);
+      }
+      if (n > 1)
+      {
+        expand(k, 1, root.second);
+      }
+      return state(m_values.begin(), m_width);
+    }
+
+    /// \brief Returns the number of states in the set.
+    std::size_t size() const
+    {
+      return m_roots.size();
+    }
+
+    /// \brief Removes all states from the set.
+    void clear()
+    {
+      initialize(m_width);
+      m_roots.clear();
+    }
+};
+
+} // namespace lps
+
+} // namespace mcrl2
+
+#endif // MCRL2_LPS_TREE_COMPRESSED_STATE_SET_H
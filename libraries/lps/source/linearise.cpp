@@ -9290,6 +9290,175 @@ class specification_basic_type
       }
     }
 
+    /// \brief Calculates the non empty sub-multisets of the multi-actions in allowlist.
+    /// \details A multi-action of an operand of a parallel composition in the scope of an allow operator
+    ///          can only become part of an allowed multi-action if it is a sub-multiset of it. The result
+    ///          is sorted, and can be used to filter the operands. False is returned if there are more than
+    ///          max_size sub-multisets, in which case filtering is not worthwhile.
+    bool calculate_sub_multi_actions(const action_name_multiset_list& allowlist,
+                                     action_name_multiset_list& result,
+                                     const std::size_t max_size=10000)
+    {
+      std::set<action_name_multiset> sub_multi_actions;
+      for (const action_name_multiset& alpha: allowlist)
+      {
+        const identifier_string_list names=sortActionLabels(alpha).names();
+        const std::vector<identifier_string> sorted_names(names.begin(),names.end());
+        if (sorted_names.size()>16)
+        {
+          return false;
+        }
+        for (std::size_t subset=1; subset<(std::size_t(1)<<sorted_names.size()); ++subset)
+        {
+          identifier_string_list sub_names;
+          for (std::size_t i=sorted_names.size(); i>0; --i)
+          {
+            if ((subset>>(i-1)) & 1)
+            {
+              sub_names.push_front(sorted_names[i-1]);
+            }
+          }
+          sub_multi_actions.insert(action_name_multiset(sub_names));
+          if (sub_multi_actions.size()>max_size)
+          {
+            return false;
+          }
+        }
+      }
+      result=action_name_multiset_list(sub_multi_actions.begin(),sub_multi_actions.end());
+      return true;
+    }
+
+    /// \brief Calculates the multi-actions that can be mapped on a multi-action in allowlist by the
+    ///        communications, i.e., in which any result of a communication can be replaced by its left
+    ///        hand side. False is returned if there are more than max_size of them.
+    bool calculate_inverse_communications(const communication_expression_list& communications,
+                                          const action_name_multiset_list& allowlist,
+                                          action_name_multiset_list& result,
+                                          const std::size_t max_size=10000)
+    {
+      std::set<action_name_multiset> inverse_multi_actions;
+      for (const action_name_multiset& alpha: allowlist)
+      {
+        std::vector<std::vector<identifier_string> > prefixes(1);
+        for (const identifier_string& a: alpha.names())
+        {
+          std::vector<std::vector<identifier_string> > new_prefixes;
+          for (const std::vector<identifier_string>& prefix: prefixes)
+          {
+            new_prefixes.push_back(prefix);
+            new_prefixes.back().push_back(a);
+            for (const communication_expression& c: communications)
+            {
+              if (c.name()==a)
+              {
+                new_prefixes.push_back(prefix);
+                const identifier_string_list& lhs=c.action_name().names();
+                new_prefixes.back().insert(new_prefixes.back().end(),lhs.begin(),lhs.end());
+              }
+            }
+          }
+          if (new_prefixes.size()>max_size)
+          {
+            return false;
+          }
+          prefixes.swap(new_prefixes);
+        }
+        for (const std::vector<identifier_string>& names: prefixes)
+        {
+          inverse_multi_actions.insert(sortActionLabels(action_name_multiset(identifier_string_list(names.begin(),names.end()))));
+        }
+        if (inverse_multi_actions.size()>max_size)
+        {
+          return false;
+        }
+      }
+      result=action_name_multiset_list(inverse_multi_actions.begin(),inverse_multi_actions.end());
+      return true;
+    }
+
+    /// \brief Removes the actions that occur in the left hand side of a communication from the
+    ///        actions in blocklist. A multi-action of an operand of the communication operator that
+    ///        contains one of the remaining actions is blocked, whatever it is combined with.
+    identifier_string_list uncommunicated_block_set(const communication_expression_list& communications,
+                                                    const identifier_string_list& blocklist)
+    {
+      identifier_string_list result;
+      for (const identifier_string& a: blocklist)
+      {
+        bool occurs_in_lhs=false;
+        for (const communication_expression& c: communications)
+        {
+          const identifier_string_list& lhs=c.action_name().names();
+          if (std::find(lhs.begin(),lhs.end(),a)!=lhs.end())
+          {
+            occurs_in_lhs=true;
+            break;
+          }
+        }
+        if (!occurs_in_lhs)
+        {
+          result.push_front(a);
+        }
+      }
+      return result;
+    }
+
+    /// \brief Linearise the parallel composition t modulo an allow or block operator.
+    /// \details The summands are filtered with allowlist as in parallelcomposition. If filter_operands is set,
+    ///          operands of t that are parallel compositions themselves are linearised modulo operand_allowlist,
+    ///          which must contain all sub-multisets of its multi-actions if is_allow is set. This way the
+    ///          multi-actions that cannot survive the allow or block operator are not generated at all.
+    void generateLPEmCRLmerge(
+      stochastic_action_summand_vector& action_summands,
+      deadlock_summand_vector& deadlock_summands,
+      const process::merge& t,
+      const bool regular,
+      const bool rename_variables,
+      variable_list& pars,
+      assignment_list& init,
+      stochastic_distribution& initial_stochastic_distribution,
+      lps::detail::ultimate_delay& ultimate_delay_condition,
+      const action_name_multiset_list& allowlist,
+      const bool is_allow,
+      const bool is_block,
+      const action_name_multiset_list& operand_allowlist,
+      const bool filter_operands)
+    {
+      variable_list pars1,pars2;
+      assignment_list init1,init2;
+      stochastic_distribution initial_stochastic_distribution1, initial_stochastic_distribution2;
+      stochastic_action_summand_vector action_summands1, action_summands2;
+      deadlock_summand_vector deadlock_summands1, deadlock_summands2;
+      lps::detail::ultimate_delay ultimate_delay_condition1, ultimate_delay_condition2;
+      if (filter_operands && is_merge(t.left()))
+      {
+        generateLPEmCRLmerge(action_summands1,deadlock_summands1,process::merge(t.left()),
+                             regular,rename_variables,pars1,init1,initial_stochastic_distribution1,ultimate_delay_condition1,
+                             operand_allowlist,is_allow,is_block,operand_allowlist,true);
+      }
+      else
+      {
+        generateLPEmCRLterm(action_summands1,deadlock_summands1,t.left(),
+                            regular,rename_variables,pars1,init1,initial_stochastic_distribution1,ultimate_delay_condition1);
+      }
+      if (filter_operands && is_merge(t.right()))
+      {
+        generateLPEmCRLmerge(action_summands2,deadlock_summands2,process::merge(t.right()),
+                             regular,true,pars2,init2,initial_stochastic_distribution2,ultimate_delay_condition2,
+                             operand_allowlist,is_allow,is_block,operand_allowlist,true);
+      }
+      else
+      {
+        generateLPEmCRLterm(action_summands2,deadlock_summands2,t.right(),
+                            regular,true,pars2,init2,initial_stochastic_distribution2,ultimate_delay_condition2);
+      }
+      parallelcomposition(action_summands1,deadlock_summands1,pars1,init1,initial_stochastic_distribution1,ultimate_delay_condition1,
+                          action_summands2,deadlock_summands2,pars2,init2,initial_stochastic_distribution2,ultimate_delay_condition2,
+                          allowlist,is_allow,is_block,
+                          action_summands,deadlock_summands,pars,init,initial_stochastic_distribution,ultimate_delay_condition);
+    }
+
     /**************** GENERaTE LPEmCRL **********************************/
 
 
@@ -9428,27 +9597,34 @@ class specification_basic_type
         process_expression par = allow(t).operand();
         if (!options.nodeltaelimination && options.ignore_time && is_merge(par))
         {
-          // Perform parallel composition with inline allow.
-          variable_list pars1,pars2;
-          assignment_list init1,init2;
-          stochastic_distribution initial_stochastic_distribution1, initial_stochastic_distribution2;
-          stochastic_action_summand_vector action_summands1, action_summands2;
-          deadlock_summand_vector deadlock_summands1, deadlock_summands2;
-          lps::detail::ultimate_delay ultimate_delay_condition1, ultimate_delay_condition2;
-          generateLPEmCRLterm(action_summands1,deadlock_summands1,process::merge(par).left(),
-                                regular,rename_variables,pars1,init1,initial_stochastic_distribution1,ultimate_delay_condition1);
-          generateLPEmCRLterm(action_summands2,deadlock_summands2,process::merge(par).right(),
-                                regular,true,pars2,init2,initial_stochastic_distribution2,ultimate_delay_condition2);
-          parallelcomposition(action_summands1,deadlock_summands1,pars1,init1,initial_stochastic_distribution1,ultimate_delay_condition1,
-                                action_summands2,deadlock_summands2,pars2,init2,initial_stochastic_distribution2,ultimate_delay_condition2,
-                                allow(t).allow_set(),true,false,
-                                action_summands,deadlock_summands,pars,init,initial_stochastic_distribution,ultimate_delay_condition);
+          // Perform parallel composition with inline allow. Nested parallel compositions are
+          // linearised modulo the sub-multisets of the allowed multi-actions.
+          action_name_multiset_list sub_multi_actions;
+          const bool filter_operands=calculate_sub_multi_actions(allow(t).allow_set(),sub_multi_actions);
+          generateLPEmCRLmerge(action_summands,deadlock_summands,process::merge(par),
+                               regular,rename_variables,pars,init,initial_stochastic_distribution,ultimate_delay_condition,
+                               allow(t).allow_set(),true,false,sub_multi_actions,filter_operands);
           return;
         }
         else if (!options.nodeltaelimination && options.ignore_time && is_comm(par))
         {
-          generateLPEmCRLterm(action_summands,deadlock_summands,comm(par).operand(),
-                                regular,rename_variables,pars,init,initial_stochastic_distribution,ultimate_delay_condition);
+          // If the operand of the communication operator is a parallel composition, it is linearised
+          // modulo the sub-multisets of the multi-actions that communicate to an allowed multi-action.
+          action_name_multiset_list inverse_multi_actions;
+          action_name_multiset_list sub_multi_actions;
+          if (is_merge(comm(par).operand()) &&
+              calculate_inverse_communications(comm(par).comm_set(),allow(t).allow_set(),inverse_multi_actions) &&
+              calculate_sub_multi_actions(inverse_multi_actions,sub_multi_actions))
+          {
+            generateLPEmCRLmerge(action_summands,deadlock_summands,process::merge(comm(par).operand()),
+                                 regular,rename_variables,pars,init,initial_stochastic_distribution,ultimate_delay_condition,
+                                 sub_multi_actions,true,false,sub_multi_actions,true);
+          }
+          else
+          {
+            generateLPEmCRLterm(action_summands,deadlock_summands,comm(par).operand(),
+                                  regular,rename_variables,pars,init,initial_stochastic_distribution,ultimate_delay_condition);
+          }
           communicationcomposition(comm(par).comm_set(),allow(t).allow_set(),true,false,action_summands,deadlock_summands);
           return;
         }
@@ -9461,39 +9637,39 @@ class specification_basic_type
       if (is_block(t))
       {
         process_expression par = block(t).operand();
+        // Encode the actions of the block list in one multi action.
+        const action_name_multiset_list blocklist({action_name_multiset(block(t).block_set())});
         if (!options.nodeltaelimination && options.ignore_time && is_merge(par))
         {
-          // Perform parallel composition with inline block.
-          variable_list pars1,pars2;
-          assignment_list init1,init2;
-          stochastic_distribution initial_stochastic_distribution1, initial_stochastic_distribution2;
-          stochastic_action_summand_vector action_summands1, action_summands2;
-          deadlock_summand_vector deadlock_summands1, deadlock_summands2;
-          lps::detail::ultimate_delay ultimate_delay_condition1, ultimate_delay_condition2;
-          generateLPEmCRLterm(action_summands1,deadlock_summands1,process::merge(par).left(),
-                                regular,rename_variables,pars1,init1,initial_stochastic_distribution1,ultimate_delay_condition1);
-          generateLPEmCRLterm(action_summands2,deadlock_summands2,process::merge(par).right(),
-                                regular,true,pars2,init2,initial_stochastic_distribution2,ultimate_delay_condition2);
-          // Encode the actions of the block list in one multi action.
-          parallelcomposition(action_summands1,deadlock_summands1,pars1,init1,initial_stochastic_distribution1,ultimate_delay_condition1,
-                                action_summands2,deadlock_summands2,pars2,init2,initial_stochastic_distribution2,ultimate_delay_condition2,
-                                action_name_multiset_list({action_name_multiset(block(t).block_set())}),false,true,
-                                action_summands,deadlock_summands,pars,init,initial_stochastic_distribution,ultimate_delay_condition);
+          // Perform parallel composition with inline block, also in nested parallel compositions.
+          generateLPEmCRLmerge(action_summands,deadlock_summands,process::merge(par),
+                               regular,rename_variables,pars,init,initial_stochastic_distribution,ultimate_delay_condition,
+                               blocklist,false,true,blocklist,true);
           return;
         }
         else if (!options.nodeltaelimination && options.ignore_time && is_comm(par))
         {
-          generateLPEmCRLterm(action_summands,deadlock_summands,comm(par).operand(),
-                                regular,rename_variables,pars,init,initial_stochastic_distribution,ultimate_delay_condition);
-          // Encode the actions of the block list in one multi action.
-          communicationcomposition(comm(par).comm_set(),action_name_multiset_list( { action_name_multiset(block(t).block_set())} ),
-                                                     false,true,action_summands,deadlock_summands);
+          // A multi-action of a parallel composition in the scope of the communication operator is
+          // blocked if it contains a blocked action that does not take part in a communication.
+          const identifier_string_list uncommunicated=uncommunicated_block_set(comm(par).comm_set(),block(t).block_set());
+          if (is_merge(comm(par).operand()) && !uncommunicated.empty())
+          {
+            const action_name_multiset_list uncommunicated_blocklist({action_name_multiset(uncommunicated)});
+            generateLPEmCRLmerge(action_summands,deadlock_summands,process::merge(comm(par).operand()),
+                                 regular,rename_variables,pars,init,initial_stochastic_distribution,ultimate_delay_condition,
+                                 uncommunicated_blocklist,false,true,uncommunicated_blocklist,true);
+          }
+          else
+          {
+            generateLPEmCRLterm(action_summands,deadlock_summands,comm(par).operand(),
+                                  regular,rename_variables,pars,init,initial_stochastic_distribution,ultimate_delay_condition);
+          }
+          communicationcomposition(comm(par).comm_set(),blocklist,false,true,action_summands,deadlock_summands);
           return;
         }
 
         generateLPEmCRLterm(action_summands,deadlock_summands,par,regular,rename_variables,pars,init,initial_stochastic_distribution,ultimate_delay_condition);
-        // Encode the actions of the block list in one multi action.
-        allowblockcomposition(action_name_multiset_list({action_name_multiset(block(t).block_set())}),false,action_summands,deadlock_summands);
+        allowblockcomposition(blocklist,false,action_summands,deadlock_summands);
         return;
       }
 
@@ -0,0 +1,110 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file explorer_test.cpp
+/// \brief Tests for the explorer.
+
+#define BOOST_TEST_MODULE explorer_test
+#include <tuple>
+#include <boost/test/included/unit_test_framework.hpp>
+#include "mcrl2/lps/explorer.h"
+#include "mcrl2/lps/parse.h"
+
+using namespace mcrl2;
+using namespace mcrl2::lps;
+
+typedef std::tuple<std::size_t, std::string, std::size_t> transition;
+
+std::vector<transition> explore(const specification& lpsspec, const explorer_options& options)
+{
+  explorer explorer(lpsspec, options);
+
+  std::vector<transition> result;
+  explorer.generate_state_space(false, false,
+    utilities::skip(),
+    [&](const state&, std::size_t s_index, const process::timed_multi_action& a, const state&, std::size_t s1_index, std::size_t)
+    {
+      result.emplace_back(s_index, process::pp(a), s1_index);
+    }
+  );
+  return result;
+}
+
+void check_incremental_guard_evaluation(const std::string& text, bool confluence = false)
+{
+  specification lpsspec = parse_linear_process_specification(text);
+  explorer_options options;
+  options.search_strategy = es_breadth;
+  options.confluence = confluence;
+  std::vector<transition> expected = explore(lpsspec, options);
+  options.incremental_guard_evaluation = true;
+  std::vector<transition> result = explore(lpsspec, options);
+  BOOST_CHECK(!expected.empty());
+  BOOST_CHECK(result == expected);
+}
+
+BOOST_AUTO_TEST_CASE(test_incremental_guard_evaluation)
+{
+  // Summand b is disabled until a has been done three times, and summand c does not change the condition of b.
+  check_incremental_guard_evaluation(
+    "act a, b, c: Nat;\n"
+    "proc P(i: Nat, j: Nat) =\n"
+    "       (i < 3) -> a(i) . P(i = i + 1)\n"
+    "     + (i == 3 && j < 2) -> b(j) . P(j = j + 1)\n"
+    "     + (j < 2) -> c(j) . P(j = j + 1)\n"
+    "     + sum k: Nat . (k < 2 && j == 2) -> a(k) . P(i = 0, j = k);\n"
+    "init P(0, 0);\n"
+  );
+}
+
+BOOST_AUTO_TEST_CASE(test_incremental_guard_evaluation_confluence)
+{
+  // The confluent summand changes i, which is tested by the condition of summand b.
+  check_incremental_guard_evaluation(
+    "act a, b: Nat;\n"
+    "    ctau;\n"
+    "proc P(i: Nat, j: Nat) =\n"
+    "       (j < 3) -> a(j) . P(j = j + 1)\n"
+    "     + (i == 1) -> b(j) . P(i = 2)\n"
+    "     + (i == 0) -> ctau . P(i = 1);\n"
+    "init P(0, 0);\n",
+    true
+  );
+}
+
+BOOST_AUTO_TEST_CASE(test_hashed_state_sets)
+{
+  specification lpsspec = parse_linear_process_specification(
+    "act a, b: Nat;\n"
+    "proc P(i: Nat, j: Nat) =\n"
+    "       (i < 5) -> a(i) . P(i = i + 1)\n"
+    "     + (j < 5) -> b(j) . P(j = j + 1)\n"
+    "     + (i == 5 && j == 5) -> a(0) . P(i = 0, j = 0);\n"
+    "init P(0, 0);\n"
+  );
+  explorer_options options;
+  options.search_strategy = es_breadth;
+  std::vector<transition> expected = explore(lpsspec, options);
+  BOOST_CHECK_EQUAL(expected.size(), 61u);
+
+  // With a large table, it is very unlikely that states are missed.
+  options.bit_hashing = true;
+  options.bit_hash_size = 1 << 20;
+  options.number_of_hash_functions = 3;
+  BOOST_CHECK(explore(lpsspec, options) == expected);
+
+  options.bit_hashing = false;
+  options.hash_compaction = true;
+  BOOST_CHECK(explore(lpsspec, options) == expected);
+
+  // With a table of one bit, only the initial state is explored.
+  options.hash_compaction = false;
+  options.bit_hashing = true;
+  options.bit_hash_size = 1;
+  BOOST_CHECK_EQUAL(explore(lpsspec, options).size(), 2u);
+}
@@ -14,6 +14,7 @@
 
 
 #include <iostream>
+#include <set>
 #include <string>
 
 #include "mcrl2/data/detail/rewrite_strategies.h"
@@ -129,6 +130,49 @@ BOOST_AUTO_TEST_CASE(type_checking_a_finite_set_with_numbers_can_go_astray)
   run_linearisation_test_case(spec,true);
 }
 
+// Returns the multi-actions of the action summands of the linearisation of spec without alphabet
+// reduction, such that allow and block operators are applied while calculating parallel compositions.
+static std::set<std::string> linearised_multi_actions(const std::string& spec)
+{
+  t_lin_options options;
+  options.ignore_time=true;
+  process::process_specification procspec=process::parse_process_specification(spec,false);
+  lps::stochastic_specification s=linearise(procspec, options);
+  std::set<std::string> result;
+  for (const lps::stochastic_action_summand& summand: s.process().action_summands())
+  {
+    result.insert(lps::pp(summand.multi_action()));
+  }
+  return result;
+}
+
+BOOST_AUTO_TEST_CASE(allow_and_block_in_nested_parallel_compositions)
+{
+  const std::string allow_spec =
+     "act a,b,ab,c,d;\n"
+     "proc P = a.P;\n"
+     "     Q = b.Q + d.Q;\n"
+     "     R = c.R;\n"
+     "init allow({ab, ab|c}, comm({a|b->ab}, P || Q || R));\n";
+  BOOST_CHECK(linearised_multi_actions(allow_spec) == std::set<std::string>({ "ab", "ab|c" }));
+
+  const std::string block_spec =
+     "act a,b,ab,c,d;\n"
+     "proc P = a.P;\n"
+     "     Q = b.Q + d.Q;\n"
+     "     R = c.R;\n"
+     "init block({b, c, d}, comm({a|b->ab}, P || Q || R));\n";
+  BOOST_CHECK(linearised_multi_actions(block_spec) == std::set<std::string>({ "a", "ab" }));
+
+  const std::string nested_spec =
+     "act a,b,c,d;\n"
+     "proc P = a.P;\n"
+     "     Q = b.Q + d.Q;\n"
+     "     R = c.R;\n"
+     "init allow({a|b, c}, P || Q || R);\n";
+  BOOST_CHECK(linearised_multi_actions(nested_spec) == std::set<std::string>({ "a|b", "c" }));
+}
+
 #ifndef MCRL2_SKIP_LONG_TESTS 
 
 BOOST_AUTO_TEST_CASE(Type_checking_of_function_can_be_problematic)
@@ -0,0 +1,103 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file partial_order_reduction_test.cpp
+/// \brief Tests for partial order reduction in the explorer.
+
+#define BOOST_TEST_MODULE partial_order_reduction_test
+#include <boost/test/included/unit_test_framework.hpp>
+#include "mcrl2/lps/explorer.h"
+#include "mcrl2/lps/parse.h"
+
+using namespace mcrl2;
+using namespace mcrl2::lps;
+
+struct exploration_result
+{
+  std::size_t states = 0;
+  std::size_t transitions = 0;
+  std::size_t deadlocks = 0;
+  std::set<core::identifier_string> actions;
+};
+
+exploration_result explore(const specification& lpsspec, bool partial_order_reduction, const std::set<core::identifier_string>& visible_actions = {})
+{
+  explorer_options options;
+  options.search_strategy = es_breadth;
+  options.partial_order_reduction = partial_order_reduction;
+  options.visible_actions = visible_actions;
+  explorer explorer(lpsspec, options);
+
+  exploration_result result;
+  std::size_t outgoing = 0;
+  explorer.generate_state_space(false, false,
+    [&](const state&, std::size_t) { result.states++; },
+    [&](const state&, std::size_t, const process::timed_multi_action& a, const state&, std::size_t, std::size_t)
+    {
+      result.transitions++;
+      outgoing++;
+      for (const process::action& ai: a.actions())
+      {
+        result.actions.insert(ai.label().name());
+      }
+    },
+    [&](const state&, std::size_t) { outgoing = 0; },
+    [&](const state&, std::size_t, std::size_t)
+    {
+      if (outgoing == 0)
+      {
+        result.deadlocks++;
+      }
+    }
+  );
+  return result;
+}
+
+// Two independent counters, followed by an action c once both counters are finished.
+const std::string COUNTERS =
+  "act a, b, c;\n"
+  "proc P(i: Nat, j: Nat) =\n"
+  "       (i < 3) -> a . P(i = i + 1)\n"
+  "     + (j < 3) -> b . P(j = j + 1)\n"
+  "     + (i == 3 && j == 3) -> c . P(i = 4);\n"
+  "init P(0, 0);\n"
+  ;
+
+BOOST_AUTO_TEST_CASE(test_deadlocks)
+{
+  specification lpsspec = parse_linear_process_specification(COUNTERS);
+  exploration_result full = explore(lpsspec, false);
+  exploration_result reduced = explore(lpsspec, true);
+  BOOST_CHECK_EQUAL(full.states, 17u);
+  BOOST_CHECK_EQUAL(reduced.states, 8u);
+  BOOST_CHECK_EQUAL(full.deadlocks, 1u);
+  BOOST_CHECK_EQUAL(reduced.deadlocks, 1u);
+  BOOST_CHECK(reduced.actions == full.actions);
+}
+
+// The counters now run forever, and a can be interrupted by the visible action d.
+const std::string CYCLIC_COUNTERS =
+  "act a, b, d;\n"
+  "proc P(i: Nat, j: Nat) =\n"
+  "       (i < 3) -> a . P(i = i + 1)\n"
+  "     + (i == 3) -> a . P(i = 0)\n"
+  "     + (j < 3) -> b . P(j = j + 1)\n"
+  "     + (j == 3) -> b . P(j = 0)\n"
+  "     + (i == 2) -> d . P(i = 5);\n"
+  "init P(0, 0);\n"
+  ;
+
+BOOST_AUTO_TEST_CASE(test_visible_actions)
+{
+  specification lpsspec = parse_linear_process_specification(CYCLIC_COUNTERS);
+  exploration_result full = explore(lpsspec, false);
+  exploration_result reduced = explore(lpsspec, true, { core::identifier_string("d") });
+  BOOST_CHECK(reduced.states < full.states);
+  BOOST_CHECK_EQUAL(reduced.deadlocks, full.deadlocks);
+  BOOST_CHECK(reduced.actions.count(core::identifier_string("d")) > 0);
+}
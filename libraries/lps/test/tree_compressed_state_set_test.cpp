@@ -0,0 +1,75 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file tree_compressed_state_set_test.cpp
+/// \brief Tests for the class tree_compressed_state_set.
+
+#define BOOST_TEST_MODULE tree_compressed_state_set_test
+#include <boost/test/included/unit_test_framework.hpp>
+#include <vector>
+
+#include "mcrl2/data/standard_numbers_utility.h"
+#include "mcrl2/lps/tree_compressed_state_set.h"
+
+using namespace mcrl2;
+using namespace mcrl2::lps;
+
+inline
+state make_state(std::size_t width, std::size_t value)
+{
+  std::vector<data::data_expression> v;
+  for (std::size_t i = 0; i < width; i++)
+  {
+    v.push_back(data::sort_nat::nat((value >> i) & 1));
+  }
+  return state(v.begin(), width);
+}
+
+void test_width(std::size_t width)
+{
+  tree_compressed_state_set S;
+  std::size_t n = std::size_t(1) << width;
+  for (std::size_t i = 0; i < n; i++)
+  {
+    std::pair<std::size_t, bool> p = S.insert(make_state(width, i));
+    BOOST_CHECK(p.first == i);
+    BOOST_CHECK(p.second);
+  }
+  BOOST_CHECK_EQUAL(S.size(), n);
+
+  for (std::size_t i = 0; i < n; i++)
+  {
+    state s = make_state(width, i);
+    std::pair<std::size_t, bool> p = S.insert(s);
+    BOOST_CHECK(p.first == i);
+    BOOST_CHECK(!p.second);
+    BOOST_CHECK(S.index(s) == i);
+    BOOST_CHECK(S[i] == s);
+  }
+  BOOST_CHECK_EQUAL(S.size(), n);
+
+  if (width > 0)
+  {
+    state s = make_state(width, 0);
+    std::vector<data::data_expression> v(s.begin(), s.end());
+    v.back() = data::sort_nat::nat(2);
+    BOOST_CHECK(!S.contains(state(v.begin(), width)));
+  }
+
+  S.clear();
+  BOOST_CHECK_EQUAL(S.size(), 0u);
+  BOOST_CHECK(!S.contains(make_state(width, 0)));
+}
+
+BOOST_AUTO_TEST_CASE(test_main)
+{
+  for (std::size_t width = 0; width <= 7; width++)
+  {
+    test_width(width);
+  }
+}
@@ -14,6 +14,7 @@
 
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "mcrl2/lts/lts_fsm.h"
@@ -220,12 +221,36 @@ struct fsm_builder
   std::vector<fsm_parameter> parameters;
 
   // Maps labels of the FSM to numbers
-  std::map<std::string, std::size_t> labels;
+  std::unordered_map<std::string, std::size_t> labels;
 
   // This variable records if the initial state is set explicitly.
   // If not it needs to be done while finishing the fsm.
   bool m_initial_state_is_set;
 
+  // Adds a transition of which max is the largest state number. The target is reset.
+  void add_transition(std::size_t source, std::size_t max, const std::string& label, detail::lts_fsm_base::probabilistic_state& target)
+  {
+    if (fsm.num_states() <= max)
+    {
+      fsm.set_num_states(max, fsm.has_state_info());
+    }
+    std::unordered_map<std::string, std::size_t>::const_iterator i = labels.find(label);
+    lts_fsm_t::labels_size_type label_index = 0;
+    if (i == labels.end())
+    {
+      assert(label != action_label_string::tau_action());
+      label_index = fsm.add_action(action_label_string(label));
+      labels[label] = label_index;
+    }
+    else
+    {
+      label_index = i->second;
+    }
+
+    const std::size_t probabilistic_state_index=fsm.add_and_reset_probabilistic_state(target);
+    fsm.add_transition(transition(source, label_index, probabilistic_state_index));
+  }
+
   void start()
   {
     parameters.clear();
@@ -242,26 +267,18 @@ struct fsm_builder
     {
       max=std::max(max,p.state());
     }
-    if (fsm.num_states() <= max)
-    {
-      fsm.set_num_states(max, fsm.has_state_info());
-    }
-    std::map<std::string, std::size_t>::const_iterator i = labels.find(t.label());
-    lts_fsm_t::labels_size_type label_index = 0;
-    if (i == labels.end())
-    {
-      assert(t.label() != action_label_string::tau_action());
-      label_index = fsm.add_action(action_label_string(t.label()));
-      labels[t.label()] = label_index;
-    }
-    else
+    add_transition(t.source(), max, t.label(), t.target());
+  }
+
+  /// \brief Adds a transition to a single target state. As in the FSM file, the states are numbered from 1.
+  void add_transition(std::size_t source, std::size_t target, const std::string& label)
+  {
+    if (source == 0 || target == 0)
     {
-      label_index = i->second;
+      throw mcrl2::runtime_error("A transition contains a state with state number 0.");
     }
-
-
-    const std::size_t probabilistic_state_index=fsm.add_probabilistic_state(detail::lts_fsm_base::probabilistic_state(t.target()));
-    fsm.add_transition(transition(t.source(), label_index, probabilistic_state_index));
+    detail::lts_fsm_base::probabilistic_state probabilistic_target(target - 1);
+    add_transition(source - 1, std::max(source, target) - 1, label, probabilistic_target);
   }
 
   void add_state(const std::vector<std::size_t>& values)
@@ -137,15 +137,15 @@ void reflexive_transitive_tau_closure(lts<STATE_LABEL_T, ACTION_LABEL_T, LTS_BAS
 }
 
 
-/// \brief Removes each transition s-a->s' if also transitions s-a->-tau->s' or s-tau->-a->s' are 
-///        present. It uses the hidden_label_map to determine whether transitions are internal. 
-template < class STATE_LABEL_T, class ACTION_LABEL_T, class LTS_BASE_CLASS >
-void remove_redundant_transitions(lts<STATE_LABEL_T, ACTION_LABEL_T, LTS_BASE_CLASS>& l)
+// Removes redundant transitions, where the outgoing transitions of all states are stored in a TRANSITIONS_PER_STATE.
+template < class TRANSITIONS_PER_STATE, class STATE_LABEL_T, class ACTION_LABEL_T, class LTS_BASE_CLASS >
+void remove_redundant_transitions_per_state(lts<STATE_LABEL_T, ACTION_LABEL_T, LTS_BASE_CLASS>& l)
 {
   typedef typename lts<STATE_LABEL_T, ACTION_LABEL_T, LTS_BASE_CLASS>::states_size_type state_type;
   typedef typename lts<STATE_LABEL_T, ACTION_LABEL_T, LTS_BASE_CLASS>::labels_size_type label_type;
+  typedef typename TRANSITIONS_PER_STATE::content_type outgoing_pair_type;
 
-  outgoing_transitions_per_state_t outgoing_transitions(l.get_transitions(),l.num_states(),true);
+  TRANSITIONS_PER_STATE outgoing_transitions(l.get_transitions(),l.num_states(),true);
   l.clear_transitions();
   std::set < state_type > states_reachable_in_one_visible_action;
   std::set < state_type > states_reachable_in_one_hidden_action;
@@ -158,7 +158,7 @@ void remove_redundant_transitions(lts<STATE_LABEL_T, ACTION_LABEL_T, LTS_BASE_CL
     // for(const outgoing_pair_t& p: vec)
     for(size_t j=outgoing_transitions.lowerbound(from); j<outgoing_transitions.upperbound(from); ++j)
     {
-      const outgoing_pair_t& p = outgoing_transitions.get_transitions()[j];
+      const outgoing_pair_type& p = outgoing_transitions.get_transitions()[j];
       const state_type from_=from;         // the start state of a transition under consideration. 
       const label_type label_=label(p);    // the label
       const state_type to_=to(p);          // the target state
@@ -171,7 +171,7 @@ void remove_redundant_transitions(lts<STATE_LABEL_T, ACTION_LABEL_T, LTS_BASE_CL
       // for(const outgoing_pair_t& j: outgoing_transitions[from_])
       for(size_t j_=outgoing_transitions.lowerbound(from_); j_<outgoing_transitions.upperbound(from_); ++j_)
       {
-        const outgoing_pair_t& j = outgoing_transitions.get_transitions()[j_];
+        const outgoing_pair_type& j = outgoing_transitions.get_transitions()[j_];
         if (l.is_tau(l.apply_hidden_label_map(label(j))))
         {
           states_reachable_in_one_hidden_action.insert(to(j));
@@ -194,7 +194,7 @@ void remove_redundant_transitions(lts<STATE_LABEL_T, ACTION_LABEL_T, LTS_BASE_CL
         // for(const outgoing_pair_t& j: outgoing_transitions[middle])
         for(size_t j_=outgoing_transitions.lowerbound(middle); j_<outgoing_transitions.upperbound(middle); ++j_)
         {
-          const outgoing_pair_t& j=outgoing_transitions.get_transitions()[j_];
+          const outgoing_pair_type& j=outgoing_transitions.get_transitions()[j_];
           if (l.is_tau(l.apply_hidden_label_map(label_)))
           { 
             if (l.is_tau(l.apply_hidden_label_map(label(j))) && to(j)==to_)
@@ -223,7 +223,7 @@ void remove_redundant_transitions(lts<STATE_LABEL_T, ACTION_LABEL_T, LTS_BASE_CL
           // for(const outgoing_pair_t& j: outgoing_transitions[middle])
           for(size_t j_=outgoing_transitions.lowerbound(middle); j_<outgoing_transitions.upperbound(middle); ++j_)
           {
-            const outgoing_pair_t& j=outgoing_transitions.get_transitions()[j_];
+            const outgoing_pair_type& j=outgoing_transitions.get_transitions()[j_];
             if (l.is_tau(l.apply_hidden_label_map(label(j))) && to(j)==to_)
             { 
               assert(!found);
@@ -244,6 +244,21 @@ void remove_redundant_transitions(lts<STATE_LABEL_T, ACTION_LABEL_T, LTS_BASE_CL
   }
 }
 
+/// \brief Removes each transition s-a->s' if also transitions s-a->-tau->s' or s-tau->-a->s' are 
+///        present. It uses the hidden_label_map to determine whether transitions are internal. 
+template < class STATE_LABEL_T, class ACTION_LABEL_T, class LTS_BASE_CLASS >
+void remove_redundant_transitions(lts<STATE_LABEL_T, ACTION_LABEL_T, LTS_BASE_CLASS>& l)
+{
+  if (has_compact_transitions(l))
+  {
+    remove_redundant_transitions_per_state<compact_outgoing_transitions_per_state_t>(l);
+  }
+  else
+  {
+    remove_redundant_transitions_per_state<outgoing_transitions_per_state_t>(l);
+  }
+}
+
 
 template < class STATE_LABEL_T, class ACTION_LABEL_T, class LTS_BASE_CLASS >
 void tau_star_reduce(lts< STATE_LABEL_T, ACTION_LABEL_T, LTS_BASE_CLASS >& l)
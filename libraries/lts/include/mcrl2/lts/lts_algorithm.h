@@ -295,21 +295,15 @@ template <class LTS_TYPE>
 void determinise(LTS_TYPE& l);
 
 
-/** \brief Checks whether all states in this LTS are reachable
- * from the initial state and remove unreachable states if required.
- * \details Runs in O(num_states * num_transitions) time.
- * \param[in] l The LTS on which reachability is checked.
- * \param[in] remove_unreachable Indicates whether all unreachable states
- *            should be removed from the LTS. This option does not
- *            influence the return value; the return value is with
- *            respect to the original LTS.
- * \retval true if all states are reachable from the initial state;
- * \retval false otherwise. */
-template <class SL, class AL, class BASE>
-bool reachability_check(lts < SL, AL, BASE>& l, bool remove_unreachable = false)
+namespace detail
 {
-  // First calculate which states can be reached, and store this in the array visited.
-  const outgoing_transitions_per_state_t out_trans(l.get_transitions(),l.num_states(),true);
+
+// Returns for every state of l whether it is reachable from the initial state. The outgoing
+// transitions of all states are stored in a TRANSITIONS_PER_STATE.
+template <class TRANSITIONS_PER_STATE, class SL, class AL, class BASE>
+std::vector<bool> reachable_states(const lts < SL, AL, BASE>& l)
+{
+  const TRANSITIONS_PER_STATE out_trans(l.get_transitions(),l.num_states(),true);
 
   std::vector < bool > visited(l.num_states(),false);
   std::stack<std::size_t> todo;
@@ -324,7 +318,7 @@ bool reachability_check(lts < SL, AL, BASE>& l, bool remove_unreachable = false)
     // for (const outgoing_pair_t& p: out_trans[state_to_consider])
     for (detail::state_type i=out_trans.lowerbound(state_to_consider); i<out_trans.upperbound(state_to_consider); ++i)
     {
-      const outgoing_pair_t& p=out_trans.get_transitions()[i];
+      const typename TRANSITIONS_PER_STATE::content_type& p=out_trans.get_transitions()[i];
       assert(visited[state_to_consider] && state_to_consider<l.num_states() && to(p)<l.num_states());
       if (!visited[to(p)])
       {
@@ -333,6 +327,67 @@ bool reachability_check(lts < SL, AL, BASE>& l, bool remove_unreachable = false)
       }
     }
   }
+  return visited;
+}
+
+// Returns for every state of l whether it is reachable from the initial probabilistic state.
+// The outgoing transitions of all states are stored in a TRANSITIONS_PER_STATE.
+template <class TRANSITIONS_PER_STATE, class SL, class AL, class PROBABILISTIC_STATE, class BASE>
+std::vector<bool> reachable_states(const probabilistic_lts < SL, AL, PROBABILISTIC_STATE, BASE>& l)
+{
+  const TRANSITIONS_PER_STATE out_trans(l.get_transitions(),l.num_states(),true);
+
+  std::vector < bool > visited(l.num_states(),false);
+  std::stack<std::size_t> todo;
+
+  for(const typename PROBABILISTIC_STATE::state_probability_pair& s: l.initial_probabilistic_state())
+  {
+    visited[s.state()]=true;
+    todo.push(s.state());
+  }
+
+  while (!todo.empty())
+  {
+    std::size_t state_to_consider=todo.top();
+    todo.pop();
+    // for (const outgoing_pair_t& p: out_trans[state_to_consider])
+    for (detail::state_type i=out_trans.lowerbound(state_to_consider); i<out_trans.upperbound(state_to_consider); ++i)
+    {
+      const typename TRANSITIONS_PER_STATE::content_type& p=out_trans.get_transitions()[i];
+      assert(visited[state_to_consider] && state_to_consider<l.num_states() && to(p)<l.num_probabilistic_states());
+      // Walk through the the states in this probabilistic state.
+      for(const typename PROBABILISTIC_STATE::state_probability_pair& pr: l.probabilistic_state(to(p)))
+      {
+        if (!visited[pr.state()])
+        {
+          visited[pr.state()]=true;
+          todo.push(pr.state());
+        }
+      }
+    }
+  }
+  return visited;
+}
+
+} // namespace detail
+
+/** \brief Checks whether all states in this LTS are reachable
+ * from the initial state and remove unreachable states if required.
+ * \details Runs in O(num_states * num_transitions) time.
+ * \param[in] l The LTS on which reachability is checked.
+ * \param[in] remove_unreachable Indicates whether all unreachable states
+ *            should be removed from the LTS. This option does not
+ *            influence the return value; the return value is with
+ *            respect to the original LTS.
+ * \retval true if all states are reachable from the initial state;
+ * \retval false otherwise. */
+template <class SL, class AL, class BASE>
+bool reachability_check(lts < SL, AL, BASE>& l, bool remove_unreachable = false)
+{
+  // First calculate which states can be reached, and store this in the array visited.
+  const std::vector < bool > visited = has_compact_transitions(l)
+                                       ? detail::reachable_states<compact_outgoing_transitions_per_state_t>(l)
+                                       : detail::reachable_states<outgoing_transitions_per_state_t>(l);
 
   // Property: in_visited(s) == true: state s is reachable from the initial state
 
@@ -418,37 +473,9 @@ template <class SL, class AL, class PROBABILISTIC_STATE, class BASE>
 bool reachability_check(probabilistic_lts < SL, AL, PROBABILISTIC_STATE, BASE>&  l, bool remove_unreachable = false)
 {
   // First calculate which states can be reached, and store this in the array visited.
-  const outgoing_transitions_per_state_t out_trans(l.get_transitions(),l.num_states(),true);
-
-  std::vector < bool > visited(l.num_states(),false);
-  std::stack<std::size_t> todo;
-
-  for(const typename PROBABILISTIC_STATE::state_probability_pair& s: l.initial_probabilistic_state())
-  {
-    visited[s.state()]=true;
-    todo.push(s.state());
-  }
-
-  while (!todo.empty())
-  {
-    std::size_t state_to_consider=todo.top();
-    todo.pop();
-    // for (const outgoing_pair_t& p: out_trans[state_to_consider])
-    for (detail::state_type i=out_trans.lowerbound(state_to_consider); i<out_trans.upperbound(state_to_consider); ++i)
-    {
-      const outgoing_pair_t& p=out_trans.get_transitions()[i];
-      assert(visited[state_to_consider] && state_to_consider<l.num_states() && to(p)<l.num_probabilistic_states());
-      // Walk through the the states in this probabilistic state.
-      for(const typename PROBABILISTIC_STATE::state_probability_pair& pr: l.probabilistic_state(to(p)))
-      {
-        if (!visited[pr.state()])
-        {
-          visited[pr.state()]=true;
-          todo.push(pr.state());
-        }
-      }
-    }
-  }
+  const std::vector < bool > visited = has_compact_transitions(l)
+                                       ? detail::reachable_states<compact_outgoing_transitions_per_state_t>(l)
+                                       : detail::reachable_states<outgoing_transitions_per_state_t>(l);
 
   // Property: in_visited(s) == true: state s is reachable from the initial state
 
@@ -897,34 +924,52 @@ bool destructive_compare(LTS_TYPE& l1, LTS_TYPE& l2, const lts_preorder pre, con
 }
 
 
-template <class LTS_TYPE>
+namespace detail
+{
+
+template <class TRANSITIONS_PER_STATE, class LTS_TYPE>
 bool is_deterministic(const LTS_TYPE& l)
 {
-  outgoing_transitions_per_state_action_t trans_lut=
-                  transitions_per_outgoing_state_action_pair(l.get_transitions(),l.hidden_label_map());
+  const TRANSITIONS_PER_STATE out_trans(l.get_transitions(),l.num_states(),true);
+  std::vector<std::pair<std::size_t, std::size_t> > label_target_pairs;
 
-  for(outgoing_transitions_per_state_action_t::const_iterator i=trans_lut.begin(); i!=trans_lut.end(); ++i)
+  for (std::size_t s=0; s<l.num_states(); ++s)
   {
-    outgoing_transitions_per_state_action_t::const_iterator i_next=i;
-    i_next++;
-    if (i_next!=trans_lut.end() &&
-                  from(i)==from(i_next) &&
-                  label(i)==label(i_next) &&
-                  to(i)!=to(i_next))
+    label_target_pairs.clear();
+    for (std::size_t i=out_trans.lowerbound(s); i<out_trans.upperbound(s); ++i)
     {
-      // found a pair <s,l,t> and <s,l,t'> with t!=t', so l is not deterministic.
-      return false;
+      const typename TRANSITIONS_PER_STATE::content_type& p=out_trans.get_transitions()[i];
+      label_target_pairs.push_back(std::make_pair(l.apply_hidden_label_map(label(p)), to(p)));
+    }
+    std::sort(label_target_pairs.begin(), label_target_pairs.end());
+    for (std::size_t i=1; i<label_target_pairs.size(); ++i)
+    {
+      if (label_target_pairs[i-1].first==label_target_pairs[i].first &&
+          label_target_pairs[i-1].second!=label_target_pairs[i].second)
+      {
+        // found a pair <s,l,t> and <s,l,t'> with t!=t', so l is not deterministic.
+        return false;
+      }
     }
   }
   return true;
 }
 
+} // namespace detail
+
+template <class LTS_TYPE>
+bool is_deterministic(const LTS_TYPE& l)
+{
+  return has_compact_transitions(l) ? detail::is_deterministic<compact_outgoing_transitions_per_state_t>(l)
+                                    : detail::is_deterministic<outgoing_transitions_per_state_t>(l);
+}
+
 
 namespace detail
 {
 
-template <class LTS_TYPE>
-void get_trans(const outgoing_transitions_per_state_t& begin,
+template <class TRANSITIONS_PER_STATE, class LTS_TYPE>
+void get_trans(const TRANSITIONS_PER_STATE& begin,
                tree_set_store& tss,
                std::size_t d,
                std::vector<transition>& d_trans,
@@ -940,7 +985,7 @@ void get_trans(const outgoing_transitions_per_state_t& begin,
       // for(const outgoing_pair_t& p: begin[from])
       for (detail::state_type i=begin.lowerbound(from); i<begin.upperbound(from); ++i)
       {
-        const outgoing_pair_t& p=begin.get_transitions()[i];
+        const typename TRANSITIONS_PER_STATE::content_type& p=begin.get_transitions()[i];
         d_trans.push_back(transition(from, aut.apply_hidden_label_map(label(p)), to(p)));
       }
     }
@@ -954,7 +999,10 @@ void get_trans(const outgoing_transitions_per_state_t& begin,
 } // namespace detail
 
 
-template <class LTS_TYPE>
+namespace detail
+{
+
+template <class TRANSITIONS_PER_STATE, class LTS_TYPE>
 void determinise(LTS_TYPE& l)
 {
   tree_set_store tss;
@@ -969,7 +1017,7 @@ void determinise(LTS_TYPE& l)
 
   // std::multimap < transition::size_type, std::pair < transition::size_type, transition::size_type > >
   // const outgoing_transitions_per_state_t begin(l.get_transitions(),l.hidden_label_map(),l.num_states(),true);
-  const outgoing_transitions_per_state_t begin(l.get_transitions(),l.num_states(),true);
+  const TRANSITIONS_PER_STATE begin(l.get_transitions(),l.num_states(),true);
 
   l.clear_transitions();
   l.clear_state_labels();
@@ -1039,6 +1087,21 @@ void determinise(LTS_TYPE& l)
   assert(is_deterministic(l));
 }
 
+} // namespace detail
+
+template <class LTS_TYPE>
+void determinise(LTS_TYPE& l)
+{
+  if (has_compact_transitions(l))
+  {
+    detail::determinise<compact_outgoing_transitions_per_state_t>(l);
+  }
+  else
+  {
+    detail::determinise<outgoing_transitions_per_state_t>(l);
+  }
+}
+
 } // namespace lts
 } // namespace mcrl2
 
@@ -21,6 +21,7 @@
 #include "mcrl2/lts/lts_dot.h"
 #include "mcrl2/lts/lts_fsm.h"
 #include "mcrl2/lts/lts_lts.h"
+#include "mcrl2/lts/lts_successor_index.h"
 
 namespace mcrl2 {
 
@@ -52,7 +53,7 @@ struct lts_builder
   virtual void add_transition(std::size_t from, const process::timed_multi_action& a, std::size_t to) = 0;
 
   // Add actions and states to the LTS
-  virtual void finalize(const std::unordered_map<lps::state, std::size_t>& state_map) = 0;
+  virtual void finalize(const lps::explorer& explorer) = 0;
 
   // Save the LTS to a file
   virtual void save(const std::string& filename) = 0;
@@ -66,7 +67,7 @@ class lts_none_builder: public lts_builder
     void add_transition(std::size_t /* from */, const process::timed_multi_action& /* a */, std::size_t /* to */) override
     {}
 
-    void finalize(const std::unordered_map<lps::state, std::size_t>& /* state_map */) override
+    void finalize(const lps::explorer& /* explorer */) override
     {}
 
     void save(const std::string& /* filename */) override
@@ -88,7 +89,7 @@ class lts_aut_builder: public lts_builder
     }
 
     // Add actions and states to the LTS
-    void finalize(const std::unordered_map<lps::state, std::size_t>& state_map) override
+    void finalize(const lps::explorer& explorer) override
     {
       // add actions
       m_lts.set_num_action_labels(m_actions.size());
@@ -97,7 +98,7 @@ class lts_aut_builder: public lts_builder
         m_lts.set_action_label(p.second, action_label_string(process::pp(p.first)));
       }
 
-      m_lts.set_num_states(state_map.size());
+      m_lts.set_num_states(explorer.number_of_states());
     }
 
     void save(const std::string& filename) override
@@ -131,11 +132,11 @@ class lts_aut_disk_builder: public lts_builder
     }
 
     // Add actions and states to the LTS
-    void finalize(const std::unordered_map<lps::state, std::size_t>& state_map) override
+    void finalize(const lps::explorer& explorer) override
     {
       out.flush();
       out.seekp(0);
-      out << "des (0," << m_actions.size() << "," << state_map.size() << ")";
+      out << "des (0," << m_actions.size() << "," << explorer.number_of_states() << ")";
       out.close();
     }
 
@@ -163,7 +164,7 @@ class lts_lts_builder: public lts_builder
     }
 
     // Add actions and states to the LTS
-    void finalize(const std::unordered_map<lps::state, std::size_t>& state_map) override
+    void finalize(const lps::explorer& explorer) override
     {
       // add actions
       m_lts.set_num_action_labels(m_actions.size());
@@ -173,13 +174,13 @@ class lts_lts_builder: public lts_builder
       }
 
       // add states
-      std::vector<state_label_lts> state_labels(state_map.size());
-      for (const auto& p: state_map)
+      std::vector<state_label_lts> state_labels(explorer.number_of_states());
+      for (std::size_t i = 0; i < state_labels.size(); i++)
       {
-        state_labels[p.second] = state_label_lts(p.first);
+        state_labels[i] = state_label_lts(explorer.discovered_state(i));
       }
       m_lts.state_labels() = std::move(state_labels);
-      m_lts.set_num_states(state_map.size(), true);
+      m_lts.set_num_states(explorer.number_of_states(), true);
       m_lts.set_initial_state(0);
     }
 
@@ -189,6 +190,70 @@ class lts_lts_builder: public lts_builder
     }
 };
 
+// Write transitions immediately to disk in .lts format, and add the state labels and the header later.
+// Optionally an index of the outgoing transitions of every state is written to a separate file.
+class lts_lts_disk_builder: public lts_builder
+{
+  protected:
+    data::data_specification m_dataspec;
+    process::action_label_list m_action_labels;
+    data::variable_list m_process_parameters;
+    lts_lts_stream_writer m_writer;
+    std::unique_ptr<lts_successor_index_writer> m_index;
+
+  public:
+    lts_lts_disk_builder(const std::string& filename,
+                         const data::data_specification& dataspec,
+                         const process::action_label_list& action_labels,
+                         const data::variable_list& process_parameters,
+                         const std::string& index_filename = std::string(),
+                         std::size_t block_size = 0
+                        )
+      : m_dataspec(dataspec),
+        m_action_labels(action_labels),
+        m_process_parameters(process_parameters),
+        m_writer(filename, block_size)
+    {
+      mCRL2log(log::verbose) << "writing state space in LTS format to '" << filename << "'." << std::endl;
+      if (!index_filename.empty())
+      {
+        mCRL2log(log::verbose) << "writing successor index to '" << index_filename << "'." << std::endl;
+        m_index = std::unique_ptr<lts_successor_index_writer>(new lts_successor_index_writer(index_filename));
+      }
+    }
+
+    void add_transition(std::size_t from, const process::timed_multi_action& a, std::size_t to) override
+    {
+      std::size_t label = add_action(a);
+      if (label == m_writer.num_action_labels())
+      {
+        m_writer.add_action_label(action_label_lts(lps::multi_action(a.actions(), a.time())));
+      }
+      m_writer.add_transition(transition(from, label, to));
+      if (m_index)
+      {
+        m_index->add_transition(transition(from, label, to));
+      }
+    }
+
+    // Add states to the LTS
+    void finalize(const lps::explorer& explorer) override
+    {
+      for (std::size_t i = 0; i < explorer.number_of_states(); i++)
+      {
+        m_writer.add_state_label(state_label_lts(explorer.discovered_state(i)));
+      }
+      m_writer.finish(m_dataspec, m_process_parameters, m_action_labels, 0, explorer.number_of_states());
+      if (m_index)
+      {
+        m_index->finish();
+      }
+    }
+
+    void save(const std::string& /* filename */) override
+    { }
+};
+
 class lts_dot_builder: public lts_lts_builder
 {
   public:
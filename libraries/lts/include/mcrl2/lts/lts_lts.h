@@ -19,9 +19,14 @@
 #ifndef MCRL2_LTS_LTS_MCRL2_H
 #define MCRL2_LTS_LTS_MCRL2_H
 
+#include <fstream>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
+#include "mcrl2/atermpp/aterm_io.h"
 #include "mcrl2/utilities/logger.h"
+#include "mcrl2/utilities/noncopyable.h"
 #include "mcrl2/core/detail/function_symbols.h"
 #include "mcrl2/core/parse.h"
 #include "mcrl2/data/variable.h"
@@ -453,6 +458,54 @@ class probabilistic_lts_lts_t :
      */
     void save(const std::string& filename) const;
 };
+
+/** \brief Writes a labelled transition system in .lts format to a file while it is being generated.
+    \details Transitions are written immediately, hence they are not kept in memory. Action labels
+           must be added before they are used in a transition, in the order of their indices, starting
+           at index 1. The label with index 0 is tau. State labels are optional, and must be added in the
+           order of the states. The file is completed by finish.
+*/
+class lts_lts_stream_writer : private utilities::noncopyable
+{
+  protected:
+    std::ofstream m_fstream;
+    std::unique_ptr<atermpp::binary_aterm_output> m_stream;
+    std::unordered_map<atermpp::aterm_appl, atermpp::aterm> m_cache;
+    std::size_t m_num_action_labels = 1;
+    std::size_t m_num_state_labels = 0;
+
+  public:
+    /** \brief Opens the file to which the lts is written.
+     *  \details If the filename is empty, the lts is written to stdout.
+     *  \param[in] filename Name of the file to which the lts is written.
+     *  \param[in] block_size If non-zero, the file is written in the windowed binary aterm format with blocks
+     *             of at most this number of shared subterms.
+     */
+    explicit lts_lts_stream_writer(const std::string& filename, std::size_t block_size = 0);
+
+    /** \brief Writes the action label with index num_action_labels(). */
+    void add_action_label(const action_label_lts& label);
+
+    /** \brief Writes the given transition. */
+    void add_transition(const transition& t);
+
+    /** \brief Writes the state label of the next state. */
+    void add_state_label(const state_label_lts& label);
+
+    /** \brief The number of action labels, including tau. */
+    std::size_t num_action_labels() const
+    {
+      return m_num_action_labels;
+    }
+
+    /** \brief Writes the header of the lts and closes the file. */
+    void finish(const data::data_specification& data,
+                const data::variable_list& process_parameters,
+                const process::action_label_list& action_label_declarations,
+                std::size_t initial_state,
+                std::size_t num_states);
+};
+
 } // namespace lts
 } // namespace mcrl2
 
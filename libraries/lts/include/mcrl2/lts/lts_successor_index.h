@@ -0,0 +1,274 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/lts/lts_successor_index.h
+/// \brief An index file that gives access to the outgoing transitions of a state, without loading the LTS.
+
+#ifndef MCRL2_LTS_LTS_SUCCESSOR_INDEX_H
+#define MCRL2_LTS_LTS_SUCCESSOR_INDEX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "mcrl2/lts/transition.h"
+#include "mcrl2/utilities/exception.h"
+#include "mcrl2/utilities/noncopyable.h"
+
+namespace mcrl2 {
+
+namespace lts {
+
+namespace detail {
+
+// The last bytes of an index file.
+static const char successor_index_magic[] = "mCRL2IDX";
+static const std::size_t successor_index_magic_size = 8;
+
+// The size of a (state, offset) pair in the table at the end of an index file.
+static const std::size_t successor_index_entry_size = 16;
+
+// Writes x with 7 bits per byte, using the highest bit to indicate that more bytes follow.
+// Returns the number of bytes that were written.
+inline
+std::size_t write_varint(std::ostream& out, std::uint64_t x)
+{
+  std::size_t n = 1;
+  while (x >= 0x80)
+  {
+    out.put(static_cast<char>((x & 0x7f) | 0x80));
+    x >>= 7;
+    n++;
+  }
+  out.put(static_cast<char>(x));
+  return n;
+}
+
+inline
+std::uint64_t read_varint(std::istream& in)
+{
+  std::uint64_t result = 0;
+  for (unsigned int shift = 0; shift < 64; shift += 7)
+  {
+    int c = in.get();
+    if (c == std::char_traits<char>::eof())
+    {
+      throw mcrl2::runtime_error("Unexpected end of file in successor index.");
+    }
+    result |= static_cast<std::uint64_t>(c & 0x7f) << shift;
+    if ((c & 0x80) == 0)
+    {
+      return result;
+    }
+  }
+  throw mcrl2::runtime_error("Invalid number in successor index.");
+}
+
+// Maps small positive and negative differences to small unsigned numbers.
+inline
+std::uint64_t zigzag_encode(std::uint64_t to, std::uint64_t from)
+{
+  return to >= from ? 2 * (to - from) : 2 * (from - to) - 1;
+}
+
+inline
+std::uint64_t zigzag_decode(std::uint64_t x, std::uint64_t from)
+{
+  return (x & 1) == 0 ? from + x / 2 : from - (x + 1) / 2;
+}
+
+inline
+void write_uint64(std::ostream& out, std::uint64_t x)
+{
+  for (std::size_t i = 0; i < 8; i++)
+  {
+    out.put(static_cast<char>((x >> (8 * i)) & 0xff));
+  }
+}
+
+inline
+std::uint64_t read_uint64(std::istream& in)
+{
+  unsigned char bytes[8];
+  if (!in.read(reinterpret_cast<char*>(bytes), 8))
+  {
+    throw mcrl2::runtime_error("Unexpected end of file in successor index.");
+  }
+  std::uint64_t result = 0;
+  for (std::size_t i = 0; i < 8; i++)
+  {
+    result |= static_cast<std::uint64_t>(bytes[i]) << (8 * i);
+  }
+  return result;
+}
+
+} // namespace detail
+
+/// \brief Writes an index of the outgoing transitions of the states of an LTS to a file.
+/// \details The outgoing transitions of a state are stored in a block, that consists of the number of
+/// transitions followed by the label and the target of each transition. The target is stored as the
+/// difference with the previous target, which is initially the source state. All numbers are stored
+/// as variable length integers. A block is written as soon as a transition with another source state
+/// is added, hence it is most efficient to add transitions grouped by source state, as is done during
+/// state space exploration. At the end of the file there is a table with a (state, offset) pair of
+/// fixed width for every block, sorted on states. It is followed by the offset of the table, the number
+/// of entries in the table, and a magic string.
+class lts_successor_index_writer: private utilities::noncopyable
+{
+  protected:
+    std::ofstream m_stream;
+    std::uint64_t m_offset = 0;
+
+    // The transitions of the current block.
+    std::size_t m_from = 0;
+    std::vector<std::pair<std::size_t, std::size_t>> m_successors;
+
+    // The (state, offset) pairs of the blocks.
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> m_table;
+
+    void write_block()
+    {
+      if (m_successors.empty())
+      {
+        return;
+      }
+      m_table.emplace_back(m_from, m_offset);
+      m_offset += detail::write_varint(m_stream, m_successors.size());
+      std::uint64_t previous = m_from;
+      for (const auto& p: m_successors)
+      {
+        m_offset += detail::write_varint(m_stream, p.first);
+        m_offset += detail::write_varint(m_stream, detail::zigzag_encode(p.second, previous));
+        previous = p.second;
+      }
+      m_successors.clear();
+    }
+
+  public:
+    explicit lts_successor_index_writer(const std::string& filename)
+      : m_stream(filename, std::ofstream::out | std::ofstream::binary)
+    {
+      if (!m_stream.is_open())
+      {
+        throw mcrl2::runtime_error("Fail to open file " + filename + " for writing.");
+      }
+    }
+
+    void add_transition(const transition& t)
+    {
+      if (t.from() != m_from)
+      {
+        write_block();
+        m_from = t.from();
+      }
+      m_successors.emplace_back(t.label(), t.to());
+    }
+
+    /// \brief Writes the table and closes the file.
+    void finish()
+    {
+      write_block();
+      std::stable_sort(m_table.begin(), m_table.end(),
+                       [](const std::pair<std::uint64_t, std::uint64_t>& x, const std::pair<std::uint64_t, std::uint64_t>& y) { return x.first < y.first; });
+      for (const auto& entry: m_table)
+      {
+        detail::write_uint64(m_stream, entry.first);
+        detail::write_uint64(m_stream, entry.second);
+      }
+      detail::write_uint64(m_stream, m_offset);
+      detail::write_uint64(m_stream, m_table.size());
+      m_stream.write(detail::successor_index_magic, detail::successor_index_magic_size);
+      m_stream.close();
+      if (m_stream.fail())
+      {
+        throw mcrl2::runtime_error("Fail to write the successor index correctly.");
+      }
+      m_table.clear();
+    }
+};
+
+/// \brief Reads the outgoing transitions of a state from an index file written by lts_successor_index_writer.
+/// \details Only the table entries of the requested state and its blocks are read from the file.
+class lts_successor_index_reader: private utilities::noncopyable
+{
+  protected:
+    std::ifstream m_stream;
+    std::uint64_t m_table_offset;
+    std::uint64_t m_table_size;
+
+    std::uint64_t state_of_entry(std::uint64_t i)
+    {
+      m_stream.seekg(m_table_offset + i * detail::successor_index_entry_size);
+      return detail::read_uint64(m_stream);
+    }
+
+  public:
+    explicit lts_successor_index_reader(const std::string& filename)
+      : m_stream(filename, std::ifstream::in | std::ifstream::binary)
+    {
+      if (!m_stream.is_open())
+      {
+        throw mcrl2::runtime_error("Fail to open file " + filename + " to read a successor index.");
+      }
+      m_stream.seekg(-static_cast<std::streamoff>(16 + detail::successor_index_magic_size), std::ios::end);
+      m_table_offset = detail::read_uint64(m_stream);
+      m_table_size = detail::read_uint64(m_stream);
+      char magic[detail::successor_index_magic_size];
+      if (!m_stream.read(magic, detail::successor_index_magic_size) ||
+          std::memcmp(magic, detail::successor_index_magic, detail::successor_index_magic_size) != 0)
+      {
+        throw mcrl2::runtime_error("The file " + filename + " is not a successor index.");
+      }
+    }
+
+    /// \brief Returns the outgoing transitions of state s, in the order in which they were written.
+    std::vector<transition> successors(std::size_t s)
+    {
+      // Find the first entry of s by binary search.
+      std::uint64_t first = 0;
+      std::uint64_t count = m_table_size;
+      while (count > 0)
+      {
+        std::uint64_t step = count / 2;
+        if (state_of_entry(first + step) < s)
+        {
+          first += step + 1;
+          count -= step + 1;
+        }
+        else
+        {
+          count = step;
+        }
+      }
+
+      std::vector<transition> result;
+      for (std::uint64_t i = first; i < m_table_size && state_of_entry(i) == s; i++)
+      {
+        std::uint64_t offset = detail::read_uint64(m_stream);
+        m_stream.seekg(offset);
+        std::uint64_t n = detail::read_varint(m_stream);
+        std::uint64_t previous = s;
+        for (std::uint64_t j = 0; j < n; j++)
+        {
+          std::size_t label = detail::read_varint(m_stream);
+          previous = detail::zigzag_decode(detail::read_varint(m_stream), previous);
+          result.emplace_back(s, label, previous);
+        }
+      }
+      return result;
+    }
+};
+
+} // namespace lts
+
+} // namespace mcrl2
+
+#endif // MCRL2_LTS_LTS_SUCCESSOR_INDEX_H
@@ -18,6 +18,8 @@
 #ifndef MCRL2_LTS_LTS_UTILITIES_H
 #define MCRL2_LTS_LTS_UTILITIES_H
 
+#include <cstdint>
+#include <limits>
 #include <map>
 #include <set>
 #include "mcrl2/core/identifier_string.h"
@@ -53,22 +55,31 @@ inline std::size_t apply_map(const std::size_t n, std::map<transition::size_type
 // start. So, the tau transitions reside at position indices[s] to indices[s+1]. These indices
 // can be acquired using the functions lowerbound and upperbound. 
 // This data structure is chosen due to its minimal memory and time footprint. 
-template <class CONTENT>
+// The type INDEX is used for the indices. The types of CONTENT and INDEX must be large enough
+// to contain the labels and states, respectively the number of transitions. For lts's with
+// less than 2^32 states, labels and transitions, the compact variant below with 32 bit numbers
+// halves the memory footprint. 
+template <class CONTENT, class INDEX = std::size_t>
 class indexed_sorted_vector_for_transitions
 {
+  public:
+    typedef CONTENT content_type;
+
   protected:
     typedef std::size_t state_type;
-    typedef std::size_t label_type;
-    typedef std::pair<label_type,state_type> label_state_pair;
+    typedef typename CONTENT::first_type label_type;
+    typedef typename CONTENT::second_type target_type;
 
     std::vector < CONTENT > m_states_with_outgoing_or_incoming_transition;
-    std::vector <size_t> m_indices;
+    std::vector < INDEX > m_indices;
 
   public:
 
     indexed_sorted_vector_for_transitions(const std::vector < transition >& transitions , state_type num_states, bool outgoing)
      : m_indices(num_states+1,0)
     {
+      assert(transitions.size() <= std::numeric_limits<INDEX>::max());
+
       // First count the number of outgoing transitions per state and put it in indices.
       for(const transition& t: transitions)
       {
@@ -79,8 +90,8 @@ class indexed_sorted_vector_for_transitions
       // Put the starting index for state i at position i-1. When placing the transitions these indices
       // are decremented properly. 
       
-      size_t sum=0;
-      for(state_type& i: m_indices)  // The vector is changed. This must be a reference. 
+      INDEX sum=0;
+      for(INDEX& i: m_indices)  // The vector is changed. This must be a reference. 
       {
         sum=sum+i;
         i=sum;
@@ -91,13 +102,16 @@ class indexed_sorted_vector_for_transitions
       m_states_with_outgoing_or_incoming_transition.resize(sum);
       for(const transition& t: transitions)
       {
+        assert(t.label() <= std::numeric_limits<label_type>::max());
+        assert(t.from() <= std::numeric_limits<target_type>::max() && t.to() <= std::numeric_limits<target_type>::max());
         if (outgoing)
         {
           assert(t.from()<m_indices.size());
           assert(m_indices[t.from()]>0);
           m_indices[t.from()]--;
           assert(m_indices[t.from()] < m_states_with_outgoing_or_incoming_transition.size());
-          m_states_with_outgoing_or_incoming_transition[m_indices[t.from()]]=label_state_pair(t.label(), t.to());
+          m_states_with_outgoing_or_incoming_transition[m_indices[t.from()]]=
+                    CONTENT(static_cast<label_type>(t.label()), static_cast<target_type>(t.to()));
         }
         else
         {
@@ -105,7 +119,8 @@ class indexed_sorted_vector_for_transitions
           assert(m_indices[t.to()]>0);
           m_indices[t.to()]--;
           assert(m_indices[t.to()] < m_states_with_outgoing_or_incoming_transition.size());
-          m_states_with_outgoing_or_incoming_transition[m_indices[t.to()]]=label_state_pair(t.label(), t.from());
+          m_states_with_outgoing_or_incoming_transition[m_indices[t.to()]]=
+                    CONTENT(static_cast<label_type>(t.label()), static_cast<target_type>(t.from()));
         }
       }
       assert(m_indices.at(num_states)==m_states_with_outgoing_or_incoming_transition.size());
@@ -134,8 +149,8 @@ class indexed_sorted_vector_for_transitions
     // Drastically clear the vectors by resetting its memory usage to minimal. 
     void clear()   
     {
-      std::vector <state_type>().swap(m_states_with_outgoing_or_incoming_transition);
-      std::vector <size_t>().swap(m_indices);
+      std::vector <CONTENT>().swap(m_states_with_outgoing_or_incoming_transition);
+      std::vector <INDEX>().swap(m_indices);
       
     }
 };
@@ -160,6 +175,32 @@ inline std::size_t to(const outgoing_pair_t& p)
   return p.second;
 }
 
+/// \brief Type for exploring transitions per state, using 32 bit numbers for labels, states and transitions.
+typedef std::pair<std::uint32_t, std::uint32_t> compact_outgoing_pair_t;
+
+typedef detail::indexed_sorted_vector_for_transitions < compact_outgoing_pair_t, std::uint32_t > compact_outgoing_transitions_per_state_t;
+
+/// \brief Label of a compact pair of a label and target state. 
+inline std::size_t label(const compact_outgoing_pair_t& p)
+{
+  return p.first;
+}
+
+/// \brief Target state of a compact label state pair. 
+inline std::size_t to(const compact_outgoing_pair_t& p)
+{
+  return p.second;
+}
+
+/// \brief Indicates whether the transitions of l can be stored in a compact_outgoing_transitions_per_state_t.
+/// \details Algorithms use this to select the compact representation when it is possible.
+template <class LTS_TYPE>
+bool has_compact_transitions(const LTS_TYPE& l)
+{
+  const std::size_t max = std::numeric_limits<std::uint32_t>::max();
+  return l.num_states() < max && l.num_action_labels() <= max && l.num_transitions() <= max;
+}
+
 /// \brief Type for exploring transitions per state and action.
 typedef std::multimap<std::pair<transition::size_type, transition::size_type>, transition::size_type>
 outgoing_transitions_per_state_action_t;
@@ -12,7 +12,10 @@
 #ifndef MCRL2_LTS_PARSE_H
 #define MCRL2_LTS_PARSE_H
 
+#include <algorithm>
 #include <cctype>
+#include <cstring>
+#include <iterator>
 #include <sstream>
 
 #include <boost/xpressive/xpressive.hpp>
@@ -46,6 +49,9 @@ class simple_fsm_parser
     boost::xpressive::sregex regex_quoted_string;
     boost::xpressive::sregex regex_probabilistic_initial_distribution;
 
+    // Buffer for the label of a transition
+    std::string label;
+
     states next_state(states state)
     {
       switch (state)
@@ -121,6 +127,56 @@ class simple_fsm_parser
       builder.add_transition(source, target, label);
     }
 
+    static bool is_space(char c)
+    {
+      return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
+    }
+
+    static const char* parse_number(const char* first, const char* last, std::size_t& value)
+    {
+      value = 0;
+      for (; first != last && '0' <= *first && *first <= '9'; ++first)
+      {
+        value = 10 * value + (*first - '0');
+      }
+      return first;
+    }
+
+    // Parses a transition of the shape: source target "label", which is the common case for non
+    // probabilistic state spaces, without constructing strings for the state numbers. Returns false
+    // if the line does not have this shape, or refers to state number 0, in which case it must be
+    // handled by parse_transition.
+    bool parse_plain_transition(const char* first, const char* last)
+    {
+      std::size_t source;
+      const char* p = parse_number(first, last, source);
+      if (p == first || p == last || !is_space(*p))
+      {
+        return false;
+      }
+      for (; p != last && is_space(*p); ++p) {}
+
+      std::size_t target;
+      const char* q = parse_number(p, last, target);
+      if (q == p || q == last || !is_space(*q))
+      {
+        return false;
+      }
+      for (; q != last && is_space(*q); ++q) {}
+
+      if (q == last || *q != '"' || *(last - 1) != '"' || q == last - 1 || std::find(q + 1, last - 1, '"') != last - 1)
+      {
+        return false;
+      }
+      if (source == 0 || target == 0)
+      {
+        return false;
+      }
+      label.assign(q + 1, last - 1);
+      builder.add_transition(source, target, label);
+      return true;
+    }
+
     void parse_initial_distribution(const std::string& line)
     {
       std::string text = utilities::trim_copy(line);
@@ -157,36 +213,60 @@ class simple_fsm_parser
       regex_probabilistic_initial_distribution = boost::xpressive::sregex::compile("0|([1-9][0-9]*)|\\[[^\\]]*\\]");
     }
 
-    void run(std::istream& from)
+    /// \brief Parses the FSM in the characters [first, last).
+    void run(const char* first, const char* last)
     {
       builder.start();
 
       states state = PARAMETERS;
-      std::string line;
-      while (std::getline(from, line))
+      while (first != last)
       {
+        const char* end_of_line = static_cast<const char*>(std::memchr(first, '\n', last - first));
+        if (end_of_line == nullptr)
+        {
+          end_of_line = last;
+        }
+
+        // Remove leading and trailing whitespace.
+        const char* line_begin = first;
+        const char* line_end = end_of_line;
+        for (; line_begin != line_end && is_space(*line_begin); ++line_begin) {}
+        for (; line_end != line_begin && is_space(*(line_end - 1)); --line_end) {}
+        first = (end_of_line == last ? last : end_of_line + 1);
+
+        if (line_begin == line_end)  // This deals with the case when there are empty lines in or at the end of the file.
+        {
+          continue;
+        }
+        if (state == TRANSITIONS && parse_plain_transition(line_begin, line_end))
+        {
+          continue;
+        }
 
-        utilities::trim(line);
-        if (line != "")  // This deals with the case when there are empty lines in or at the end of the file.
-        { 
-          if (line == "---")
+        const std::string line(line_begin, line_end);
+        if (line == "---")
+        {
+          state = next_state(state);
+        }
+        else
+        {
+          switch (state)
           {
-            state = next_state(state);
-          }
-          else 
-          { 
-            switch (state)
-            {
-              case PARAMETERS: { parse_parameter(line); break; }
-              case STATES: { parse_state(line); break; }
-              case TRANSITIONS: { parse_transition(line); break; }
-              case INITIAL_DISTRIBUTION: { parse_initial_distribution(line); break; }
-            }
+            case PARAMETERS: { parse_parameter(line); break; }
+            case STATES: { parse_state(line); break; }
+            case TRANSITIONS: { parse_transition(line); break; }
+            case INITIAL_DISTRIBUTION: { parse_initial_distribution(line); break; }
           }
         }
       }
       builder.finish();
     }
+
+    void run(std::istream& from)
+    {
+      const std::string text((std::istreambuf_iterator<char>(from)), std::istreambuf_iterator<char>());
+      run(text.data(), text.data() + text.size());
+    }
 };
 
 } // namespace detail
@@ -201,8 +281,16 @@ void parse_fsm_specification(std::istream& from, probabilistic_lts_fsm_t& result
 inline
 void parse_fsm_specification(const std::string& text, probabilistic_lts_fsm_t& result)
 {
-  std::istringstream is(text);
-  parse_fsm_specification(is, result);
+  detail::simple_fsm_parser fsm_parser(result);
+  fsm_parser.run(text.data(), text.data() + text.size());
+}
+
+/// \brief Parses the FSM in the characters [first, last).
+inline
+void parse_fsm_specification(const char* first, const char* last, probabilistic_lts_fsm_t& result)
+{
+  detail::simple_fsm_parser fsm_parser(result);
+  fsm_parser.run(first, last);
 }
 
 } // namespace lts
@@ -14,20 +14,60 @@
 #ifndef MCRL2_LTS_SIGREF_H
 #define MCRL2_LTS_SIGREF_H
 
-#include <set>
-#include <map>
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <limits>
+#include <set>
+#include <stack>
+#include <unordered_map>
 #include "mcrl2/lts/lts.h"
 #include "mcrl2/lts/lts_utilities.h"
 #include "mcrl2/utilities/logger.h"
+#include "mcrl2/utilities/parallel_for.h"
 
 namespace mcrl2
 {
 namespace lts
 {
 
-/** \brief A signature is a pair of an action label and a block */
-typedef std::set<std::pair<std::size_t, std::size_t> > signature_t;
+/** \brief A signature is a sorted vector of pairs of an action label and a block, without duplicates */
+typedef std::vector<std::pair<std::size_t, std::size_t> > signature_t;
+
+namespace detail
+{
+
+/** \brief Sorts the pairs of a signature and removes duplicates */
+inline
+void normalise_signature(signature_t& sig)
+{
+  std::sort(sig.begin(), sig.end());
+  sig.erase(std::unique(sig.begin(), sig.end()), sig.end());
+}
+
+/** \brief Mixes the bits of a 64-bit value (the finalizer of SplitMix64) */
+inline
+std::uint64_t mix_signature_bits(std::uint64_t x)
+{
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+/** \brief Computes a 64-bit hash of a normalised signature */
+inline
+std::uint64_t hash_signature(const signature_t& sig)
+{
+  std::uint64_t result = sig.size();
+  for (const std::pair<std::size_t, std::size_t>& p: sig)
+  {
+    result = mix_signature_bits(result * 0x9e3779b97f4a7c15ULL + p.first);
+    result = mix_signature_bits(result * 0x9e3779b97f4a7c15ULL + p.second);
+  }
+  return result;
+}
+
+} // namespace detail
 
 /** \brief Base class for signature computation */
 template < class LTS_T >
@@ -37,16 +77,27 @@ protected:
   /** \brief The labelled transition system for which the signature is computed */
   const LTS_T& m_lts;
 
+  /** \brief The number of threads that is used to compute the signatures */
+  std::size_t m_number_of_threads;
+
+  /** \brief The outgoing transitions per state */
+  outgoing_transitions_per_state_t m_outgoing_transitions;
+
   /** \brief Signature stored per state */
   std::vector<signature_t> m_sig;
 
 public:
   /** \brief Constructor
     */
-  signature(const LTS_T& lts_)
-    : m_lts(lts_), m_sig(m_lts.num_states(), signature_t())
+  signature(const LTS_T& lts_, std::size_t number_of_threads = 1)
+    : m_lts(lts_),
+      m_number_of_threads(number_of_threads),
+      m_outgoing_transitions(lts_.get_transitions(), lts_.num_states(), true),
+      m_sig(m_lts.num_states(), signature_t())
   {}
 
+  virtual ~signature() = default;
+
   /** \brief Compute a new signature based on \a partition.
     * \param[in] partition The current partition
     */
@@ -54,13 +105,14 @@ public:
 
   /** \brief Compute the transitions for the quotient according to \a partition.
     * \param[in] partition The partition that is used to compute the quotient
-    * \param[out] transitions A set to which the transitions of the quotient are written
+    * \param[out] transitions A vector to which the transitions of the quotient are written, possibly
+    *             more than once
     */
-  virtual void quotient_transitions(std::set<transition>& transitions, const std::vector<std::size_t>& partition)
+  virtual void quotient_transitions(std::vector<transition>& transitions, const std::vector<std::size_t>& partition)
   {
     for(std::vector<transition>::const_iterator i = m_lts.get_transitions().begin(); i != m_lts.get_transitions().end(); ++i)
     {
-      transitions.insert(transition(partition[i->from()], i->label(), partition[i->to()]));
+      transitions.push_back(transition(partition[i->from()], i->label(), partition[i->to()]));
     }
   }
 
@@ -72,6 +124,12 @@ public:
   {
     return m_sig[i];
   }
+
+  /** \brief Return the number of threads that is used to compute the signatures */
+  std::size_t number_of_threads() const
+  {
+    return m_number_of_threads;
+  }
 };
 
 /** \brief Class for computing the signature for strong bisimulation */
@@ -80,12 +138,14 @@ class signature_bisim: public signature<LTS_T>
 {
 protected:
   using signature<LTS_T>::m_lts;
+  using signature<LTS_T>::m_number_of_threads;
+  using signature<LTS_T>::m_outgoing_transitions;
   using signature<LTS_T>::m_sig;
 
 public:
   /** \brief Constructor */
-  signature_bisim(const LTS_T& lts_)
-    : signature<LTS_T>(lts_)
+  signature_bisim(const LTS_T& lts_, std::size_t number_of_threads = 1)
+    : signature<LTS_T>(lts_, number_of_threads)
   {
     mCRL2log(log::verbose, "sigref") << "initialising signature computation for strong bisimulation" << std::endl;
   }
@@ -94,65 +154,251 @@ public:
   virtual void
   compute_signature(const std::vector<std::size_t>& partition)
   {
-    // compute signatures
-    m_sig = std::vector<signature_t>(m_lts.num_states(), signature_t());
-    for(std::vector<transition>::const_iterator i = m_lts.get_transitions().begin(); i != m_lts.get_transitions().end(); ++i)
-    {
-      m_sig[i->from()].insert(std::make_pair(m_lts.apply_hidden_label_map(i->label()), partition[i->to()]));
-    }
+    // The signature of a state only depends on its own outgoing transitions, so the states are divided over
+    // the threads.
+    utilities::parallel_for_blocks(m_lts.num_states(), m_number_of_threads,
+      [&](std::size_t, std::size_t begin, std::size_t end)
+      {
+        for (std::size_t s = begin; s < end; ++s)
+        {
+          signature_t& sig = m_sig[s];
+          sig.clear();
+          for (std::size_t i = m_outgoing_transitions.lowerbound(s); i < m_outgoing_transitions.upperbound(s); ++i)
+          {
+            const outgoing_pair_t& p = m_outgoing_transitions.get_transitions()[i];
+            sig.push_back(std::make_pair(m_lts.apply_hidden_label_map(label(p)), partition[to(p)]));
+          }
+          detail::normalise_signature(sig);
+        }
+      });
   }
 
 };
 
-/** \brief Class for computing the signature for branching bisimulation */
+/** \brief Class for computing the signature for branching bisimulation
+  *
+  * The signature of a state s consists of the pairs (a, B) for all non-inert transitions t -a-> t' with
+  * t' in block B, such that t is reachable from s via inert tau transitions, i.e. tau transitions within
+  * the block of s. This is the signature of S. Blom, S. Orzan, "Distributed Branching Bisimulation
+  * Reduction of State Spaces", Proc. PDMC 2003.
+  *
+  * In every round the strongly connected components of the inert transitions are computed, since all states
+  * in such a component have the same signature. The components are grouped in levels, such that the inert
+  * successors of a component have a lower level. The signatures of the components of one level are computed
+  * in parallel.
+  */
 template < class LTS_T >
 class signature_branching_bisim: public signature<LTS_T>
 {
 protected:
   using signature<LTS_T>::m_lts;
+  using signature<LTS_T>::m_number_of_threads;
+  using signature<LTS_T>::m_outgoing_transitions;
   using signature<LTS_T>::m_sig;
 
-  /** \brief Store the incoming transitions per state */
-  outgoing_transitions_per_state_t m_prev_transitions;
+  /** \brief The component of the inert transitions of each state */
+  std::vector<std::size_t> m_component;
 
-  /** \brief Insert function
-    * \param[in] partition The current partition
-    * \param[in] t source state
-    * \param[in] label_ transition label
-    * \param[in] block target block
-    *
-    * Insert function as described in S. Blom, S. Orzan,
-    * "Distributed Branching Bisimulation Reduction of State Spaces",
-    * Proc. PDMC 2003.
-    *
-    * Inserts the pair (label_, block) in the signature of t, as well as
-    * the signatures of all tau-predecessors of t within the same block.
+  /** \brief The states of component c are m_component_states[m_component_offsets[c]], ...,
+    *        m_component_states[m_component_offsets[c+1] - 1] */
+  std::vector<std::size_t> m_component_states;
+  std::vector<std::size_t> m_component_offsets;
+
+  /** \brief The signature of each component. The signature of a state is stored in m_sig only while
+    *        the signatures are computed. */
+  std::vector<signature_t> m_component_sig;
+
+  /** \brief Indicates whether the transition s -a-> t, with a after applying the hidden label map, is inert
+    *        with respect to \a partition */
+  bool is_inert(const std::vector<std::size_t>& partition, std::size_t s, std::size_t a, std::size_t t) const
+  {
+    return m_lts.is_tau(a) && partition[s] == partition[t];
+  }
+
+  /** \brief Computes the strongly connected components of the inert transitions, using an iterative version
+    *        of Tarjan's algorithm. The components are numbered such that inert transitions only lead to
+    *        components with a number that is at most that of their source.
     */
-  void insert(const std::vector<std::size_t>& partition, const std::size_t t, const std::size_t label_, const std::size_t block)
+  void compute_inert_components(const std::vector<std::size_t>& partition)
   {
-    if(m_sig[t].insert(std::make_pair(label_, block)).second)
+    const std::size_t undefined = std::numeric_limits<std::size_t>::max();
+    const std::size_t n = m_lts.num_states();
+    std::vector<std::size_t> index(n, undefined);
+    std::vector<std::size_t> low(n, 0);
+    std::vector<std::size_t> stack;
+
+    // The states of which the outgoing transitions are being explored, with the position of the next transition.
+    std::vector<std::pair<std::size_t, std::size_t> > work;
+
+    m_component.assign(n, undefined);
+    m_component_states.clear();
+    m_component_offsets.assign(1, 0);
+    std::size_t counter = 0;
+
+    for (std::size_t root = 0; root < n; ++root)
     {
-      // std::pair<outgoing_transitions_per_state_t::const_iterator, outgoing_transitions_per_state_t::const_iterator> pred_range
-      //    = m_prev_transitions.equal_range(t);
+      if (index[root] != undefined)
+      {
+        continue;
+      }
+      index[root] = low[root] = counter++;
+      stack.push_back(root);
+      work.push_back(std::make_pair(root, m_outgoing_transitions.lowerbound(root)));
 
-      // for(outgoing_transitions_per_state_t::const_iterator i = pred_range.first; i != pred_range.second; ++i)
-      // for(const outgoing_pair_t& p: m_prev_transitions[t])
-      for (std::size_t i=m_prev_transitions.lowerbound(t); i<m_prev_transitions.upperbound(t); ++i)
+      while (!work.empty())
       {
-        const outgoing_pair_t& p = m_prev_transitions.get_transitions()[i];
-        if(m_lts.is_tau(m_lts.apply_hidden_label_map(label(p))) && partition[t] == partition[to(p)])
+        const std::size_t s = work.back().first;
+        if (work.back().second < m_outgoing_transitions.upperbound(s))
+        {
+          const outgoing_pair_t& p = m_outgoing_transitions.get_transitions()[work.back().second++];
+          const std::size_t t = to(p);
+          if (!is_inert(partition, s, m_lts.apply_hidden_label_map(label(p)), t))
+          {
+            continue;
+          }
+          if (index[t] == undefined)
+          {
+            index[t] = low[t] = counter++;
+            stack.push_back(t);
+            work.push_back(std::make_pair(t, m_outgoing_transitions.lowerbound(t)));
+          }
+          else if (m_component[t] == undefined)
+          {
+            // t is on the stack.
+            low[s] = (std::min)(low[s], index[t]);
+          }
+        }
+        else
         {
-          insert(partition, to(p), label_, block);
+          if (low[s] == index[s])
+          {
+            const std::size_t c = m_component_offsets.size() - 1;
+            std::size_t u;
+            do
+            {
+              u = stack.back();
+              stack.pop_back();
+              m_component[u] = c;
+              m_component_states.push_back(u);
+            }
+            while (u != s);
+            m_component_offsets.push_back(m_component_states.size());
+          }
+          work.pop_back();
+          if (!work.empty())
+          {
+            low[work.back().first] = (std::min)(low[work.back().first], low[s]);
+          }
         }
       }
     }
   }
 
+  /** \brief Computes the signatures of all states.
+    * \param[in] partition The current partition
+    * \param[in] divergent If not empty, then the pair (tau, B) is also added for inert transitions to states
+    *            t with divergent[t].
+    */
+  void compute_branching_signature(const std::vector<std::size_t>& partition, const std::vector<bool>& divergent)
+  {
+    // The pairs of the non-inert transitions of each state.
+    utilities::parallel_for_blocks(m_lts.num_states(), m_number_of_threads,
+      [&](std::size_t, std::size_t begin, std::size_t end)
+      {
+        for (std::size_t s = begin; s < end; ++s)
+        {
+          signature_t& sig = m_sig[s];
+          sig.clear();
+          for (std::size_t i = m_outgoing_transitions.lowerbound(s); i < m_outgoing_transitions.upperbound(s); ++i)
+          {
+            const outgoing_pair_t& p = m_outgoing_transitions.get_transitions()[i];
+            const std::size_t a = m_lts.apply_hidden_label_map(label(p));
+            if (!is_inert(partition, s, a, to(p)) || (!divergent.empty() && divergent[to(p)]))
+            {
+              sig.push_back(std::make_pair(a, partition[to(p)]));
+            }
+          }
+        }
+      });
+
+    compute_inert_components(partition);
+    const std::size_t number_of_components = m_component_offsets.size() - 1;
+
+    // The level of a component is one more than the maximal level of its inert successors.
+    std::vector<std::size_t> level(number_of_components, 0);
+    std::size_t number_of_levels = 0;
+    for (std::size_t c = 0; c < number_of_components; ++c)
+    {
+      for (std::size_t j = m_component_offsets[c]; j < m_component_offsets[c + 1]; ++j)
+      {
+        const std::size_t s = m_component_states[j];
+        for (std::size_t i = m_outgoing_transitions.lowerbound(s); i < m_outgoing_transitions.upperbound(s); ++i)
+        {
+          const outgoing_pair_t& p = m_outgoing_transitions.get_transitions()[i];
+          const std::size_t d = m_component[to(p)];
+          if (d != c && is_inert(partition, s, m_lts.apply_hidden_label_map(label(p)), to(p)))
+          {
+            level[c] = (std::max)(level[c], level[d] + 1);
+          }
+        }
+      }
+      number_of_levels = (std::max)(number_of_levels, level[c] + 1);
+    }
+
+    // Sort the components on their level.
+    std::vector<std::size_t> level_offsets(number_of_levels + 1, 0);
+    for (std::size_t c = 0; c < number_of_components; ++c)
+    {
+      level_offsets[level[c] + 1]++;
+    }
+    for (std::size_t l = 0; l < number_of_levels; ++l)
+    {
+      level_offsets[l + 1] += level_offsets[l];
+    }
+    std::vector<std::size_t> components(number_of_components);
+    std::vector<std::size_t> position(level_offsets.begin(), level_offsets.end() - 1);
+    for (std::size_t c = 0; c < number_of_components; ++c)
+    {
+      components[position[level[c]]++] = c;
+    }
+
+    // Long chains of inert transitions lead to many small levels, for which starting threads does not pay off.
+    m_component_sig.resize(number_of_components);
+    for (std::size_t l = 0; l < number_of_levels; ++l)
+    {
+      const std::size_t size = level_offsets[l + 1] - level_offsets[l];
+      utilities::parallel_for_blocks(size, size < 1000 ? 1 : m_number_of_threads,
+        [&](std::size_t, std::size_t begin, std::size_t end)
+        {
+          for (std::size_t k = level_offsets[l] + begin; k < level_offsets[l] + end; ++k)
+          {
+            const std::size_t c = components[k];
+            signature_t& sig = m_component_sig[c];
+            sig.clear();
+            for (std::size_t j = m_component_offsets[c]; j < m_component_offsets[c + 1]; ++j)
+            {
+              const std::size_t s = m_component_states[j];
+              sig.insert(sig.end(), m_sig[s].begin(), m_sig[s].end());
+              for (std::size_t i = m_outgoing_transitions.lowerbound(s); i < m_outgoing_transitions.upperbound(s); ++i)
+              {
+                const outgoing_pair_t& p = m_outgoing_transitions.get_transitions()[i];
+                const std::size_t d = m_component[to(p)];
+                if (d != c && is_inert(partition, s, m_lts.apply_hidden_label_map(label(p)), to(p)))
+                {
+                  sig.insert(sig.end(), m_component_sig[d].begin(), m_component_sig[d].end());
+                }
+              }
+            }
+            detail::normalise_signature(sig);
+          }
+        });
+    }
+  }
+
 public:
   /** \brief Constructor  */
-  signature_branching_bisim(const LTS_T& lts_)
-    : signature<LTS_T>(lts_),
-      m_prev_transitions(lts_.get_transitions(),lts_.num_states(),false)  // transitions stored backward. 
+  signature_branching_bisim(const LTS_T& lts_, std::size_t number_of_threads = 1)
+    : signature<LTS_T>(lts_, number_of_threads)
   {
     mCRL2log(log::verbose, "sigref") << "initialising signature computation for branching bisimulation" << std::endl;
   }
@@ -160,25 +406,23 @@ public:
   /** \overload */
   virtual void compute_signature(const std::vector<std::size_t>& partition)
   {
-    // compute signatures
-    m_sig = std::vector<signature_t>(m_lts.num_states(), signature_t());
-    for(std::vector<transition>::const_iterator i = m_lts.get_transitions().begin(); i != m_lts.get_transitions().end(); ++i)
-    {
-      if (!(m_lts.is_tau(m_lts.apply_hidden_label_map(i->label())) && (partition[i->from()] == partition[i->to()])))
-      {
-        insert(partition, i->from(), m_lts.apply_hidden_label_map(i->label()), partition[i->to()]);
-      }
-    }
+    compute_branching_signature(partition, std::vector<bool>());
   }
 
   /** \overload */
-  virtual void quotient_transitions(std::set<transition>& transitions, const std::vector<std::size_t>& partition)
+  virtual const signature_t& get_signature(std::size_t i) const
+  {
+    return m_component_sig[m_component[i]];
+  }
+
+  /** \overload */
+  virtual void quotient_transitions(std::vector<transition>& transitions, const std::vector<std::size_t>& partition)
   {
     for(std::vector<transition>::const_iterator i = m_lts.get_transitions().begin(); i != m_lts.get_transitions().end(); ++i)
     {
       if(partition[i->from()] != partition[i->to()] || !m_lts.is_tau(m_lts.apply_hidden_label_map(i->label())))
       {
-        transitions.insert(transition(partition[i->from()], m_lts.apply_hidden_label_map(i->label()), partition[i->to()]));
+        transitions.push_back(transition(partition[i->from()], m_lts.apply_hidden_label_map(i->label()), partition[i->to()]));
       }
     }
   }
@@ -190,8 +434,7 @@ class signature_divergence_preserving_branching_bisim: public signature_branchin
 {
 protected:
   using signature_branching_bisim<LTS_T>::m_lts;
-  using signature_branching_bisim<LTS_T>::m_sig;
-  using signature_branching_bisim<LTS_T>::insert;
+  using signature_branching_bisim<LTS_T>::compute_branching_signature;
 
   /** \brief Record for each vertex whether it is in a tau-scc */
   std::vector<bool> m_divergent;
@@ -300,8 +543,8 @@ public:
     * This initialises \a m_divergent to record for each vertex whether it is
     * in a tau-scc.
     */
-  signature_divergence_preserving_branching_bisim(const LTS_T& lts_)
-    : signature_branching_bisim<LTS_T>(lts_),
+  signature_divergence_preserving_branching_bisim(const LTS_T& lts_, std::size_t number_of_threads = 1)
+    : signature_branching_bisim<LTS_T>(lts_, number_of_threads),
       m_divergent(lts_.num_states(), false)
   {
     mCRL2log(log::verbose, "sigref") << "initialising signature computation for divergence preserving branching bisimulation" << std::endl;
@@ -315,27 +558,19 @@ public:
     */
   virtual void compute_signature(const std::vector<std::size_t>& partition)
   {
-    // compute signatures
-    m_sig = std::vector<signature_t>(m_lts.num_states(), signature_t());
-    for(std::vector<transition>::const_iterator i = m_lts.get_transitions().begin(); i != m_lts.get_transitions().end(); ++i)
-    {
-      if(!(partition[i->from()] == partition[i->to()] && m_lts.is_tau(m_lts.apply_hidden_label_map(i->label())))
-         || m_divergent[i->to()])
-      {
-        insert(partition, i->from(), m_lts.apply_hidden_label_map(i->label()), partition[i->to()]);
-      }
-    }
+    compute_branching_signature(partition, m_divergent);
   }
 
   /** \overload */
-  virtual void quotient_transitions(std::set<transition>& transitions, const std::vector<std::size_t>& partition)
+  virtual void quotient_transitions(std::vector<transition>& transitions, const std::vector<std::size_t>& partition)
   {
     for(std::vector<transition>::const_iterator i = m_lts.get_transitions().begin(); i != m_lts.get_transitions().end(); ++i)
     {
+      const signature_t& sig = this->get_signature(i->from());
       if(!(partition[i->from()] == partition[i->to()] && m_lts.is_tau(m_lts.apply_hidden_label_map(i->label())))
-         || m_sig[i->from()].find(std::make_pair(m_lts.apply_hidden_label_map(i->label()), partition[i->to()])) != m_sig[i->from()].end())
+         || std::binary_search(sig.begin(), sig.end(), std::make_pair(m_lts.apply_hidden_label_map(i->label()), partition[i->to()])))
       {
-        transitions.insert(transition(partition[i->from()], m_lts.apply_hidden_label_map(i->label()), partition[i->to()]));
+        transitions.push_back(transition(partition[i->from()], m_lts.apply_hidden_label_map(i->label()), partition[i->to()]));
       }
     }
   }
@@ -369,6 +604,31 @@ protected:
              current equivalence */
   Signature m_signature;
 
+  /** \brief The hash of the signature of each state */
+  std::vector<std::uint64_t> m_hashes;
+
+  /** \brief Hash function on states, that returns the hash of their signature */
+  struct state_hash
+  {
+    const std::vector<std::uint64_t>& hashes;
+
+    std::size_t operator()(std::size_t s) const
+    {
+      return static_cast<std::size_t>(hashes[s]);
+    }
+  };
+
+  /** \brief Equality of states with respect to their signature */
+  struct state_equal
+  {
+    const Signature& sig;
+
+    bool operator()(std::size_t s, std::size_t t) const
+    {
+      return sig.get_signature(s) == sig.get_signature(t);
+    }
+  };
+
   /** \brief Print a signature (for debugging purposes) */
   std::string print_sig(const signature_t& sig)
   {
@@ -389,8 +649,6 @@ protected:
     std::size_t count_prev = m_count;
     std::size_t iterations = 0;
 
-    m_lts.sort_transitions(mcrl2::lts::lbl_tgt_src);
-
     do
     {
       mCRL2log(log::verbose, "sigref") << "Iteration " << iterations
@@ -400,22 +658,29 @@ protected:
 
       count_prev = m_count;
 
-      // Map signatures to block numbers
-      std::map<signature_t, std::size_t> hashtable;
+      // Compute the hashes of the signatures in parallel
+      utilities::parallel_for_blocks(m_lts.num_states(), m_signature.number_of_threads(),
+        [&](std::size_t, std::size_t begin, std::size_t end)
+        {
+          for (std::size_t i = begin; i < end; ++i)
+          {
+            m_hashes[i] = detail::hash_signature(m_signature.get_signature(i));
+          }
+        });
+
+      // Map signatures to block numbers, where the blocks are numbered in the order of their first state.
+      // The table maps a state to the block of its signature.
+      std::unordered_map<std::size_t, std::size_t, state_hash, state_equal> hashtable(2 * count_prev + 1, state_hash{m_hashes}, state_equal{m_signature});
       m_count = 0;
       for(std::size_t i = 0; i < m_lts.num_states(); ++i)
       {
-        if(hashtable.find(m_signature.get_signature(i)) == hashtable.end())
+        std::pair<typename std::unordered_map<std::size_t, std::size_t, state_hash, state_equal>::iterator, bool> block = hashtable.insert(std::make_pair(i, m_count));
+        if (block.second)
         {
           mCRL2log(log::debug, "sigref") << "Adding block for signature " << print_sig(m_signature.get_signature(i)) << std::endl;
-          hashtable[m_signature.get_signature(i)] = m_count++;
+          m_count++;
         }
-      }
-
-      // Map states to block numbers
-      for(std::size_t i = 0; i < m_lts.num_states(); ++i)
-      {
-        m_partition[i] = hashtable[m_signature.get_signature(i)];
+        m_partition[i] = block.first->second;
       }
 
       ++iterations;
@@ -435,12 +700,14 @@ protected:
 
     // Compute quotient transitions
     // implemented in the signature class because it differs per equivalence.
-    std::set<transition> transitions;
+    std::vector<transition> transitions;
     m_signature.quotient_transitions(transitions, m_partition);
+    std::sort(transitions.begin(), transitions.end());
+    transitions.erase(std::unique(transitions.begin(), transitions.end()), transitions.end());
 
     // Set quotient transitions
     m_lts.clear_transitions();
-    for(std::set<transition>::const_iterator i = transitions.begin(); i != transitions.end(); ++i)
+    for(std::vector<transition>::const_iterator i = transitions.begin(); i != transitions.end(); ++i)
     {
       m_lts.add_transition(*i);
     }
@@ -449,12 +716,15 @@ protected:
 public:
   /** \brief Constructor
     * \param[in] lts_ The LTS that is being reduced
+    * \param[in] number_of_threads The number of threads that is used to compute the signatures. The result
+    *            does not depend on the number of threads.
     */
-  sigref(LTS_T& lts_)
+  sigref(LTS_T& lts_, std::size_t number_of_threads = utilities::hardware_threads())
     : m_partition(std::vector<std::size_t>(lts_.num_states(), 0)),
       m_count(0),
       m_lts(lts_),
-      m_signature(lts_)
+      m_signature(lts_, number_of_threads),
+      m_hashes(lts_.num_states(), 0)
   {}
 
   /** \brief Perform the reduction, modulo the equivalence for which the
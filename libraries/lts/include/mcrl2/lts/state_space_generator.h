@@ -385,7 +385,7 @@ class divergence_detector
         return false;
       }
 
-      std::unordered_map<lps::state, std::size_t> discovered;
+      utilities::indexed_set<lps::state> discovered;
       const lps::state* source = nullptr;
       lps::state last_discovered;
 
@@ -620,12 +620,12 @@ struct state_space_generator
           }
           if (!options.suppress_progress_messages)
           {
-            m_progress_monitor.finish_state(explorer.state_map().size(), todo_list_size);
+            m_progress_monitor.finish_state(explorer.number_of_states(), todo_list_size);
           }
         }
       );
-      m_progress_monitor.finish_exploration(explorer.state_map().size());
-      builder.finalize(explorer.state_map());
+      m_progress_monitor.finish_exploration(explorer.number_of_states());
+      builder.finalize(explorer);
     }
     catch (const data::enumerator_error& e)
     {
@@ -733,7 +733,7 @@ struct stochastic_state_space_generator
           }
           if (!options.suppress_progress_messages)
           {
-            m_progress_monitor.finish_state(explorer.state_map().size(), todo_list_size);
+            m_progress_monitor.finish_state(explorer.number_of_states(), todo_list_size);
           }
         },
 
@@ -743,8 +743,8 @@ struct stochastic_state_space_generator
           builder.set_initial_state(s_index, s.probabilities);
         }
       );
-      m_progress_monitor.finish_exploration(explorer.state_map().size());
-      builder.finalize(explorer.state_map());
+      m_progress_monitor.finish_exploration(explorer.number_of_states());
+      builder.finalize(explorer);
     }
     catch (const data::enumerator_error& e)
     {
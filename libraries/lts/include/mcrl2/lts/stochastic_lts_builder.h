@@ -47,7 +47,7 @@ struct stochastic_lts_builder
   virtual void add_transition(std::size_t from, const process::timed_multi_action& a, const std::list<std::size_t>& targets, const std::vector<data::data_expression>& probabilities) = 0;
 
   // Add actions and states to the LTS
-  virtual void finalize(const std::unordered_map<lps::state, std::size_t>& state_map) = 0;
+  virtual void finalize(const lps::explorer& explorer) = 0;
 
   // Save the LTS to a file
   virtual void save(const std::string& filename) = 0;
@@ -64,7 +64,7 @@ class stochastic_lts_none_builder: public stochastic_lts_builder
     void add_transition(std::size_t /* from */, const process::timed_multi_action& /* a */, const std::list<std::size_t>& /* targets */, const std::vector<data::data_expression>& /* probabilities */) override
     {}
 
-    void finalize(const std::unordered_map<lps::state, std::size_t>& /* state_map */) override
+    void finalize(const lps::explorer& /* explorer */) override
     {}
 
     void save(const std::string& /* filename */) override
@@ -138,9 +138,9 @@ class stochastic_lts_aut_builder: public stochastic_lts_builder
     }
 
     // Add actions and states to the LTS
-    void finalize(const std::unordered_map<lps::state, std::size_t>& state_map) override
+    void finalize(const lps::explorer& explorer) override
     {
-      m_number_of_states = state_map.size();
+      m_number_of_states = explorer.number_of_states();
     }
 
     void save(std::ostream& out) const
@@ -224,7 +224,7 @@ class stochastic_lts_lts_builder: public stochastic_lts_builder
     }
 
     // Add actions and states to the LTS
-    void finalize(const std::unordered_map<lps::state, std::size_t>& state_map) override
+    void finalize(const lps::explorer& explorer) override
     {
       // add actions
       m_lts.set_num_action_labels(m_actions.size());
@@ -234,13 +234,13 @@ class stochastic_lts_lts_builder: public stochastic_lts_builder
       }
 
       // add states
-      std::vector<state_label_lts> state_labels(state_map.size());
-      for (const auto& p: state_map)
+      std::vector<state_label_lts> state_labels(explorer.number_of_states());
+      for (std::size_t i = 0; i < state_labels.size(); i++)
       {
-        state_labels[p.second] = state_label_lts(p.first);
+        state_labels[i] = state_label_lts(explorer.discovered_state(i));
       }
       m_lts.state_labels() = std::move(state_labels);
-      m_lts.set_num_states(state_map.size(), true);
+      m_lts.set_num_states(explorer.number_of_states(), true);
     }
 
     // Save the LTS to a file
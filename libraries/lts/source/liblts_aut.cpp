@@ -8,10 +8,17 @@
 //
 /// \file liblts_aut.cpp
 
+#include <algorithm>
+#include <cstring>
+#include <deque>
 #include <string>
 #include <sstream>
 #include <fstream>
+#include <iterator>
+#include <streambuf>
 #include <unordered_map>
+#include "mcrl2/utilities/memory_mapped_file.h"
+#include "mcrl2/utilities/parallel_for.h"
 #include "mcrl2/lts/lts_aut.h"
 #include "mcrl2/lts/detail/liblts_swap_to_from_probabilistic_lts.h"
 
@@ -475,6 +482,407 @@ static void read_from_aut(lts_aut_t& l, istream& is)
 }
 
 
+namespace
+{
+
+/// \brief A stream buffer that reads directly from a range of characters in memory.
+class aut_memory_buffer: public std::streambuf
+{
+  public:
+    aut_memory_buffer(const char* begin, const char* end)
+    {
+      setg(const_cast<char*>(begin), const_cast<char*>(begin), const_cast<char*>(end));
+    }
+
+    /// \brief The position of the next character that will be read.
+    const char* position() const
+    {
+      return gptr();
+    }
+};
+
+/// \brief A label as a range of characters, which is either part of the input or stored in an aut_label_table.
+struct aut_label_view
+{
+  const char* data;
+  std::size_t size;
+
+  bool operator==(const aut_label_view& other) const
+  {
+    return size==other.size && std::memcmp(data, other.data, size)==0;
+  }
+};
+
+struct aut_label_view_hash
+{
+  std::size_t operator()(const aut_label_view& l) const
+  {
+    // FNV-1a.
+    std::size_t hash=14695981039346656037ULL;
+    for (std::size_t i=0; i<l.size; ++i)
+    {
+      hash=(hash ^ static_cast<unsigned char>(l.data[i]))*1099511628211ULL;
+    }
+    return hash;
+  }
+};
+
+/// \brief Assigns consecutive indices to labels in the order in which they are first encountered.
+///        The label tau always gets index 0. Labels are not copied unless whitespace had to be removed.
+class aut_label_table
+{
+  protected:
+    std::unordered_map<aut_label_view, std::size_t, aut_label_view_hash> m_indices;
+    std::vector<aut_label_view> m_labels;
+    std::deque<std::string> m_stripped_labels;
+
+  public:
+    aut_label_table()
+    {
+      const std::string& tau=action_label_string::tau_action();
+      index(aut_label_view{tau.data(), tau.size()});
+    }
+
+    /// \brief Returns the index of the label, which is added if it did not occur yet.
+    /// \details The characters of the label must stay available as long as this table is used.
+    std::size_t index(const aut_label_view& label)
+    {
+      const std::pair<std::unordered_map<aut_label_view, std::size_t, aut_label_view_hash>::const_iterator, bool> p=
+                 m_indices.insert(std::make_pair(label, m_labels.size()));
+      if (p.second)
+      {
+        m_labels.push_back(label);
+      }
+      return p.first->second;
+    }
+
+    /// \brief Returns the index of a label that is stored in a temporary string.
+    std::size_t index(const std::string& label)
+    {
+      const std::unordered_map<aut_label_view, std::size_t, aut_label_view_hash>::const_iterator i=
+                 m_indices.find(aut_label_view{label.data(), label.size()});
+      if (i!=m_indices.end())
+      {
+        return i->second;
+      }
+      m_stripped_labels.push_back(label);
+      return index(aut_label_view{m_stripped_labels.back().data(), m_stripped_labels.back().size()});
+    }
+
+    std::size_t size() const
+    {
+      return m_labels.size();
+    }
+
+    const aut_label_view& label(std::size_t i) const
+    {
+      return m_labels[i];
+    }
+};
+
+inline bool is_aut_whitespace(char c)
+{
+  return c==' ' || c=='\n' || c=='\r' || c=='\t' || c=='\v' || c=='\f';
+}
+
+inline const char* skip_aut_whitespace(const char* p, const char* end)
+{
+  while (p!=end && is_aut_whitespace(*p))
+  {
+    ++p;
+  }
+  return p;
+}
+
+inline const char* read_aut_number(const char* p, const char* end, std::size_t& result, const std::size_t line_no)
+{
+  p=skip_aut_whitespace(p, end);
+  if (p==end || !isdigit(static_cast<unsigned char>(*p)))
+  {
+    throw mcrl2::runtime_error("Expect a number at line " + std::to_string(line_no) + ".");
+  }
+  result=0;
+  for( ; p!=end && isdigit(static_cast<unsigned char>(*p)); ++p)
+  {
+    result=10*result+(*p-'0');
+  }
+  return p;
+}
+
+/// \brief Reads the transitions in [begin, end) of a non probabilistic .aut file directly from memory.
+/// \details The input is read in the same way as by read_aut_transition. For each transition
+///          add_transition(from, label, to) is called, where label is an index in labels.
+///          The variable contains_multiline_label is set to true if a label contains a newline.
+template <typename AddTransition>
+void read_aut_transitions(
+  const char* begin,
+  const char* end,
+  std::size_t line_no,
+  const std::size_t number_of_states,
+  aut_label_table& labels,
+  bool& contains_multiline_label,
+  AddTransition add_transition)
+{
+  std::string stripped_label;
+  const char* p=begin;
+  while (true)
+  {
+    p=skip_aut_whitespace(p, end);
+    if (p==end)
+    {
+      return;
+    }
+    line_no++;
+
+    if (*p != '(')
+    {
+      throw mcrl2::runtime_error("Expect opening bracket at line " + std::to_string(line_no) + ".");
+    }
+
+    std::size_t from;
+    p=read_aut_number(p+1, end, from, line_no);
+
+    p=skip_aut_whitespace(p, end);
+    if (p==end || *p != ',')
+    {
+      throw mcrl2::runtime_error("Expect that the first number is followed by a comma at line " + std::to_string(line_no) + ".");
+    }
+
+    p=skip_aut_whitespace(p+1, end);
+    std::size_t label;
+    if (p!=end && *p == '"')
+    {
+      // In case the label is using quotes whitespaces in the label are preserved.
+      const char* label_begin=p+1;
+      p=static_cast<const char*>(std::memchr(label_begin, '"', end-label_begin));
+      if (p==nullptr)
+      {
+        throw mcrl2::runtime_error("Expect that the second item is a quoted label (using \") at line " + std::to_string(line_no) + ".");
+      }
+      const aut_label_view l{label_begin, static_cast<std::size_t>(p-label_begin)};
+      contains_multiline_label=contains_multiline_label || std::memchr(l.data, '\n', l.size)!=nullptr;
+      label=labels.index(l);
+      p=skip_aut_whitespace(p+1, end);
+    }
+    else
+    {
+      // In case the label is not within quotes, whitespaces are removed from the label.
+      const char* label_begin=p;
+      p=(p==end?nullptr:static_cast<const char*>(std::memchr(p+1, ',', end-p-1)));
+      if (p==nullptr)
+      {
+        throw mcrl2::runtime_error("Expect a comma after the quoted label at line " + std::to_string(line_no) + ".");
+      }
+      const char* label_end=p;
+      while (label_end!=label_begin && is_aut_whitespace(*(label_end-1)))
+      {
+        --label_end;
+      }
+      if (std::find_if(label_begin, label_end, is_aut_whitespace)==label_end)
+      {
+        label=labels.index(aut_label_view{label_begin, static_cast<std::size_t>(label_end-label_begin)});
+      }
+      else
+      {
+        contains_multiline_label=contains_multiline_label || std::find(label_begin, label_end, '\n')!=label_end;
+        stripped_label.clear();
+        std::remove_copy_if(label_begin, label_end, std::back_inserter(stripped_label), is_aut_whitespace);
+        label=labels.index(stripped_label);
+      }
+    }
+
+    if (p==end || *p != ',')
+    {
+      throw mcrl2::runtime_error("Expect a comma after the quoted label at line " + std::to_string(line_no) + ".");
+    }
+
+    std::size_t to;
+    p=read_aut_number(p+1, end, to, line_no);
+
+    p=skip_aut_whitespace(p, end);
+    if (p==end || *p != ')')
+    {
+      throw mcrl2::runtime_error("Expect a closing bracket at the end of the transition at line " + std::to_string(line_no) + ".");
+    }
+
+    // Skip over spaces and a carriage return, which Windows systems typically put before a newline.
+    for (++p; p!=end && *p==' '; ++p) {}
+    if (p!=end && *p=='\r')
+    {
+      ++p;
+    }
+    if (p!=end)  // Last line does not need to be terminated with an eoln.
+    {
+      if (*p != '\n')
+      {
+        throw mcrl2::runtime_error("Expect a newline after the transition at line " + std::to_string(line_no) + ".");
+      }
+      ++p;
+    }
+
+    check_state(from, number_of_states, line_no);
+    check_state(to, number_of_states, line_no);
+    add_transition(from, label, to);
+  }
+}
+
+/// \brief The transitions of a part of a .aut file, with labels that are indices in a local label table.
+struct aut_chunk
+{
+  const char* begin;
+  const char* end;
+  aut_label_table labels;
+  std::vector<transition> transitions;
+  bool failed=false;
+};
+
+// Files of at least this size are parsed in parallel if multiple threads are available.
+const std::size_t minimal_size_for_parallel_aut_parsing=64*1024*1024;
+
+/// \brief Reads the transitions in [begin, end) in parallel by splitting the input at line boundaries into
+///        chunks, which are parsed with their own label tables and merged in order afterwards.
+/// \returns False if one of the chunks could not be parsed. In that case l is not changed and the input
+///          must be parsed sequentially to obtain the error message with the proper line number.
+bool read_aut_transitions_in_parallel(
+  lts_aut_t& l,
+  const char* begin,
+  const char* end,
+  const std::size_t number_of_states,
+  const std::size_t number_of_threads)
+{
+  std::deque<aut_chunk> chunks;
+  const std::size_t chunk_size=(end-begin)/number_of_threads+1;
+  for (const char* p=begin; p!=end; )
+  {
+    const char* q=(static_cast<std::size_t>(end-p)<=chunk_size?end:p+chunk_size);
+    q=std::find(q, end, '\n');
+    if (q!=end)
+    {
+      ++q;
+    }
+    chunks.emplace_back();
+    chunks.back().begin=p;
+    chunks.back().end=q;
+    p=q;
+  }
+
+  mcrl2::utilities::parallel_for_blocks(chunks.size(), number_of_threads,
+    [&](std::size_t, std::size_t first_chunk, std::size_t last_chunk)
+    {
+      for (std::size_t i=first_chunk; i<last_chunk; ++i)
+      {
+        aut_chunk& chunk=chunks[i];
+        try
+        {
+          bool contains_multiline_label=false;
+          read_aut_transitions(chunk.begin, chunk.end, 1, number_of_states, chunk.labels, contains_multiline_label,
+            [&chunk](std::size_t from, std::size_t label, std::size_t to)
+            {
+              chunk.transitions.emplace_back(from, label, to);
+            });
+          // A chunk boundary may be inside a label that spans multiple lines.
+          chunk.failed=contains_multiline_label;
+        }
+        catch (mcrl2::runtime_error&)
+        {
+          chunk.failed=true;
+        }
+      }
+    });
+
+  for (const aut_chunk& chunk: chunks)
+  {
+    if (chunk.failed)
+    {
+      return false;
+    }
+  }
+
+  // Assign global indices to the labels in the order of their first occurrence, which is the order
+  // in which they would have been encountered by a sequential parse.
+  aut_label_table labels;
+  std::vector<std::size_t> label_indices;
+  std::vector<std::size_t> action_indices(1, 0);
+  for (aut_chunk& chunk: chunks)
+  {
+    label_indices.resize(chunk.labels.size());
+    for (std::size_t i=0; i<chunk.labels.size(); ++i)
+    {
+      const std::size_t label=labels.index(chunk.labels.label(i));
+      if (label==action_indices.size())
+      {
+        const aut_label_view& view=labels.label(label);
+        action_indices.push_back(l.add_action(action_label_string(std::string(view.data, view.size))));
+      }
+      label_indices[i]=action_indices[label];
+    }
+    for (const transition& t: chunk.transitions)
+    {
+      l.add_transition(transition(t.from(), label_indices[t.label()], t.to()));
+    }
+    chunk.transitions=std::vector<transition>();
+  }
+  return true;
+}
+
+} // end anonymous namespace
+
+/// \brief Reads a non probabilistic .aut file that is entirely available in memory.
+/// \details This gives the same result as reading the file from a stream, but avoids the overhead
+///          of reading characters from the stream and of copying labels into strings.
+static void read_from_aut(lts_aut_t& l, const char* begin, const char* end)
+{
+  std::size_t ntrans=0, nstate=0;
+
+  aut_memory_buffer buffer(begin, end);
+  istream header(&buffer);
+  mcrl2::lts::probabilistic_lts_aut_t::probabilistic_state_t initial_probabilistic_state;
+  read_aut_header(header,initial_probabilistic_state,ntrans,nstate);
+
+  if (initial_probabilistic_state.size()>1)
+  {
+    throw mcrl2::runtime_error("Encountered an initial probability distribution while reading an non probabilistic .aut file.");
+  }
+
+  check_states(initial_probabilistic_state, nstate, 1);
+
+  if (nstate==0)
+  {
+    throw mcrl2::runtime_error("cannot parse AUT input that has no states; at least an initial state is required.");
+  }
+
+  l.set_num_states(nstate,false);
+  l.clear_transitions(ntrans); // Reserve enough space for the transitions.
+  l.set_initial_state(initial_probabilistic_state.begin()->state());
+
+  const char* transitions_begin=buffer.position();
+  const std::size_t number_of_threads=mcrl2::utilities::hardware_threads();
+  if (number_of_threads==1 ||
+      static_cast<std::size_t>(end-transitions_begin)<minimal_size_for_parallel_aut_parsing ||
+      !read_aut_transitions_in_parallel(l, transitions_begin, end, nstate, number_of_threads))
+  {
+    aut_label_table labels;
+    std::vector<std::size_t> action_indices(1, 0);
+    bool contains_multiline_label=false;
+    read_aut_transitions(transitions_begin, end, 1, nstate, labels, contains_multiline_label,
+      [&](std::size_t from, std::size_t label, std::size_t to)
+      {
+        if (label==action_indices.size())
+        {
+          const aut_label_view& view=labels.label(label);
+          action_indices.push_back(l.add_action(action_label_string(std::string(view.data, view.size))));
+        }
+        l.add_transition(transition(from,action_indices[label],to));
+      });
+  }
+
+  if (ntrans != l.num_transitions())
+  {
+    throw mcrl2::runtime_error("number of transitions read (" + std::to_string(l.num_transitions()) +
+                               ") does not correspond to the number of transition given in the header (" + std::to_string(ntrans) + ").");
+  }
+}
+
 static void write_probabilistic_state(const mcrl2::lts::probabilistic_lts_aut_t::probabilistic_state_t& prob_state, ostream& os)
 {
   mcrl2::lts::probabilistic_arbitrary_precision_fraction previous_probability;
@@ -576,22 +984,8 @@ void probabilistic_lts_aut_t::save(string const& filename) const
 
 void lts_aut_t::load(const string& filename)
 {
-  if (filename=="")
-  {
-    read_from_aut(*this,cin);
-  }
-  else
-  {
-    ifstream is(filename.c_str());
-
-    if (!is.is_open())
-    {
-      throw mcrl2::runtime_error("cannot open .aut file '" + filename + ".");
-    }
-
-    read_from_aut(*this,is);
-    is.close();
-  }
+  const mcrl2::utilities::memory_mapped_file file(filename);
+  read_from_aut(*this,file.begin(),file.end());
 }
 
 void lts_aut_t::load(istream& is)
@@ -19,6 +19,7 @@
 #include "mcrl2/lts/lts_io.h"
 #include "mcrl2/lts/parse.h"
 #include "mcrl2/lts/detail/liblts_swap_to_from_probabilistic_lts.h"
+#include "mcrl2/utilities/memory_mapped_file.h"
 
 namespace mcrl2 {
 
@@ -160,21 +161,15 @@ void probabilistic_lts_fsm_t::load(const std::string& filename)
   }
   else
   {
-    std::ifstream is(filename.c_str());
-
-    if (!is.is_open())
-    {
-      throw mcrl2::runtime_error("Cannot open .fsm file " + filename + ".");
-    }
+    const utilities::memory_mapped_file file(filename);
     try
     {
-      parse_fsm_specification(is, *this);
+      parse_fsm_specification(file.begin(), file.end(), *this);
     }
     catch (mcrl2::runtime_error& e)
     {
       throw mcrl2::runtime_error(std::string("Error parsing .fsm file.\n") + e.what());
     }
-    is.close();
   }
 }
 
@@ -363,6 +363,74 @@ static void write_to_lts(const LTS_TRANSITION_SYSTEM& lts, const std::string& fi
 
 // Implementation of public functions.
 
+lts_lts_stream_writer::lts_lts_stream_writer(const std::string& filename, std::size_t block_size)
+{
+  if (!filename.empty())
+  {
+    m_fstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    try
+    {
+      m_fstream.open(filename, std::ofstream::out | std::ofstream::binary);
+    }
+    catch (std::ofstream::failure&)
+    {
+      throw mcrl2::runtime_error("Fail to open file " + filename + " for writing.");
+    }
+  }
+  m_stream.reset(new atermpp::binary_aterm_output(filename.empty() ? std::cout : m_fstream, block_size));
+}
+
+void lts_lts_stream_writer::add_action_label(const action_label_lts& label)
+{
+  m_stream->write_term(data::detail::remove_index(atermpp::aterm_appl(detail::multi_action_header(), label.actions(), label.time()), m_cache));
+  m_num_action_labels++;
+}
+
+void lts_lts_stream_writer::add_transition(const transition& t)
+{
+  assert(t.label() < m_num_action_labels);
+  m_stream->write_term(atermpp::aterm_appl(detail::transition_header(),
+    atermpp::aterm_int(t.from()),
+    atermpp::aterm_int(t.label()),
+    atermpp::aterm_int(t.to())));
+}
+
+void lts_lts_stream_writer::add_state_label(const state_label_lts& label)
+{
+  m_stream->write_term(data::detail::remove_index(label, m_cache));
+  m_num_state_labels++;
+}
+
+void lts_lts_stream_writer::finish(const data::data_specification& data,
+                                   const data::variable_list& process_parameters,
+                                   const process::action_label_list& action_label_declarations,
+                                   std::size_t initial_state,
+                                   std::size_t num_states)
+{
+  assert(m_num_state_labels == 0 || m_num_state_labels == num_states);
+  try
+  {
+    atermpp::aterm header = atermpp::aterm_appl(detail::lts_header(),
+                data::detail::data_specification_to_aterm(data),
+                process_parameters,
+                action_label_declarations,
+                detail::encode_probabilitistic_state(probabilistic_lts_lts_t::probabilistic_state_t(initial_state), m_cache),
+                atermpp::aterm_int(num_states));
+    m_stream->write_term(data::detail::remove_index(header, m_cache));
+
+    // Destroying the stream flushes the remaining bits.
+    m_stream.reset();
+    if (m_fstream.is_open())
+    {
+      m_fstream.close();
+    }
+  }
+  catch (std::ofstream::failure&)
+  {
+    throw mcrl2::runtime_error("Fail to write lts correctly.");
+  }
+}
+
 void probabilistic_lts_lts_t::save(const std::string& filename) const
 {
   mCRL2log(log::verbose) << "Starting to save a probabilistic lts to the file " << filename << ".\n";
@@ -0,0 +1,84 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file lts_successor_index_test.cpp
+/// \brief Tests for streaming output of .lts files and successor indices.
+
+#define BOOST_TEST_MODULE lts_successor_index_test
+#include <cstdio>
+#include <boost/test/included/unit_test_framework.hpp>
+
+#include "mcrl2/lts/lts_lts.h"
+#include "mcrl2/lts/lts_successor_index.h"
+
+using namespace mcrl2;
+using namespace mcrl2::lts;
+
+BOOST_AUTO_TEST_CASE(test_successor_index)
+{
+  std::string filename = "lts_successor_index_test.idx";
+
+  // The transitions of state 2 are split over two blocks, state 3 has no transitions.
+  std::vector<transition> transitions = {
+    transition(0, 1, 1), transition(0, 2, 1000000), transition(1, 0, 0),
+    transition(2, 1, 2), transition(4, 3, 1), transition(2, 2, 4)
+  };
+
+  lts_successor_index_writer writer(filename);
+  for (const transition& t: transitions)
+  {
+    writer.add_transition(t);
+  }
+  writer.finish();
+
+  lts_successor_index_reader reader(filename);
+  for (std::size_t s = 0; s <= 1000000; s = 2 * s + 1)
+  {
+    std::vector<transition> expected;
+    for (const transition& t: transitions)
+    {
+      if (t.from() == s)
+      {
+        expected.push_back(t);
+      }
+    }
+    BOOST_CHECK(reader.successors(s) == expected);
+  }
+  BOOST_CHECK_EQUAL(reader.successors(2).size(), 2u);
+  BOOST_CHECK(reader.successors(3).empty());
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(test_lts_stream_writer)
+{
+  std::string filename = "lts_successor_index_test.lts";
+
+  process::action_label a(core::identifier_string("a"), data::sort_expression_list());
+  process::action_label b(core::identifier_string("b"), data::sort_expression_list());
+  action_label_lts la(lps::multi_action(process::action_list({ process::action(a, data::data_expression_list()) })));
+  action_label_lts lb(lps::multi_action(process::action_list({ process::action(b, data::data_expression_list()) })));
+
+  lts_lts_stream_writer writer(filename);
+  writer.add_action_label(la);
+  writer.add_transition(transition(0, 1, 1));
+  writer.add_transition(transition(1, 0, 2));
+  writer.add_action_label(lb);
+  writer.add_transition(transition(2, 2, 0));
+  writer.finish(data::data_specification(), data::variable_list(), process::action_label_list({ a, b }), 1, 3);
+
+  lts_lts_t lts;
+  lts.load(filename);
+  BOOST_CHECK_EQUAL(lts.num_states(), 3u);
+  BOOST_CHECK_EQUAL(lts.num_transitions(), 3u);
+  BOOST_CHECK_EQUAL(lts.num_action_labels(), 3u);
+  BOOST_CHECK_EQUAL(lts.initial_state(), 1u);
+  BOOST_CHECK(lts.action_label(1) == la);
+  BOOST_CHECK(lts.action_label(2) == lb);
+  BOOST_CHECK(lts.get_transitions()[2] == transition(2, 2, 0));
+  std::remove(filename.c_str());
+}
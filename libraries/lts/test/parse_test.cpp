@@ -17,6 +17,7 @@
 
 #include <boost/test/included/unit_test_framework.hpp>
 
+#include "mcrl2/lts/lts_aut.h"
 #include "mcrl2/lts/parse.h"
 
 using namespace mcrl2;
@@ -93,3 +94,69 @@ BOOST_AUTO_TEST_CASE(fsm_parser_test)
   );
 }
 
+
+// Checks that reading an .aut file directly from the file gives the same result as reading it from a stream.
+void test_aut_parser(const std::string& text)
+{
+  std::string temp_filename = "parse_test_aut.tmp";
+  {
+    std::ofstream os(temp_filename.c_str(), std::ios_base::binary);
+    os << text;
+  }
+
+  lts::lts_aut_t l1;
+  l1.load(temp_filename);
+  std::remove(temp_filename.c_str());
+
+  lts::lts_aut_t l2;
+  std::istringstream is(text);
+  l2.load(is);
+
+  BOOST_CHECK_EQUAL(l1.initial_state(), l2.initial_state());
+  BOOST_CHECK_EQUAL(l1.num_states(), l2.num_states());
+  BOOST_CHECK_EQUAL(l1.num_action_labels(), l2.num_action_labels());
+  for (std::size_t i = 0; i < std::min(l1.num_action_labels(), l2.num_action_labels()); ++i)
+  {
+    BOOST_CHECK_EQUAL(std::string(l1.action_label(i)), std::string(l2.action_label(i)));
+  }
+  BOOST_CHECK(l1.get_transitions() == l2.get_transitions());
+}
+
+BOOST_AUTO_TEST_CASE(aut_parser_test)
+{
+  test_aut_parser(
+    "des (0,5,4)\n"
+    "(0,\"a(1, 2)\",1)\n"
+    "(1,b,2)\n"
+    "( 2 , \"tau\" , 3 )  \r\n"
+    "\n"
+    "(3, c d ,0)\n"
+    "(0,\"a(1, 2)\",3)"
+  );
+
+  test_aut_parser(
+    "des (1,2,2)\r\n"
+    "(0,tau,1)\r\n"
+    "(1,\"\",0)\r\n"
+  );
+}
+
+BOOST_AUTO_TEST_CASE(aut_parser_error_test)
+{
+  std::string temp_filename = "parse_test_aut_error.tmp";
+  {
+    std::ofstream os(temp_filename.c_str(), std::ios_base::binary);
+    os << "des (0,2,2)\n(0,\"a\",1)\n(1,\"a\",2)\n";
+  }
+  lts::lts_aut_t l;
+  BOOST_CHECK_THROW(l.load(temp_filename), mcrl2::runtime_error);
+  std::remove(temp_filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(fsm_parser_without_trailing_newline_test)
+{
+  lts::probabilistic_lts_fsm_t fsm;
+  lts::parse_fsm_specification(std::string("---\r\n---\r\n1 2 \"a\"\r\n2 [1 1/2 2 1/2] \"b\"\r\n  2 1   \"tau\""), fsm);
+  BOOST_CHECK_EQUAL(fsm.num_transitions(), 3u);
+  BOOST_CHECK_EQUAL(fsm.num_action_labels(), 3u);
+}
@@ -0,0 +1,70 @@
+// Author(s): Jeroen Keiren
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file sigref_test.cpp
+/// \brief Compares the signature refinement reductions to the other bisimulation reductions.
+
+#define BOOST_TEST_MODULE sigref_test
+#include <boost/test/included/unit_test_framework.hpp>
+
+#include <random>
+#include "mcrl2/lts/lts_algorithm.h"
+#include "mcrl2/lts/lts_aut.h"
+
+using namespace mcrl2::lts;
+
+// Generates a random LTS with labels tau, a and b, in which half of the transitions are tau transitions.
+static lts_aut_t random_lts(std::size_t number_of_states, std::size_t number_of_transitions, std::mt19937& generator)
+{
+  lts_aut_t result;
+  result.add_action(action_label_string("a"));
+  result.add_action(action_label_string("b"));
+  result.set_num_states(number_of_states);
+  result.set_initial_state(0);
+
+  std::uniform_int_distribution<std::size_t> state(0, number_of_states - 1);
+  std::uniform_int_distribution<std::size_t> label(0, 3);
+  for (std::size_t i = 0; i < number_of_transitions; ++i)
+  {
+    std::size_t l = label(generator);
+    result.add_transition(transition(state(generator), l <= 1 ? 0 : l - 1, state(generator)));
+  }
+  return result;
+}
+
+template <typename Signature>
+static void check_sigref(const lts_aut_t& l, lts_equivalence eq, std::size_t number_of_threads)
+{
+  lts_aut_t expected = l;
+  reduce(expected, eq);
+
+  lts_aut_t result = l;
+  result.clear_state_labels();
+  sigref<lts_aut_t, Signature> s(result, number_of_threads);
+  s.run();
+
+  BOOST_CHECK_EQUAL(result.num_states(), expected.num_states());
+  BOOST_CHECK_EQUAL(result.num_transitions(), expected.num_transitions());
+  BOOST_CHECK(destructive_compare(result, expected, lts_eq_bisim));
+}
+
+BOOST_AUTO_TEST_CASE(test_sigref_random)
+{
+  std::mt19937 generator(1234);
+  for (std::size_t i = 0; i < 50; ++i)
+  {
+    std::size_t number_of_states = 1 + i * 40;
+    lts_aut_t l = random_lts(number_of_states, number_of_states + number_of_states / 2, generator);
+    for (std::size_t number_of_threads: { 1, 4 })
+    {
+      check_sigref<signature_bisim<lts_aut_t> >(l, lts_eq_bisim, number_of_threads);
+      check_sigref<signature_branching_bisim<lts_aut_t> >(l, lts_eq_branching_bisim, number_of_threads);
+      check_sigref<signature_divergence_preserving_branching_bisim<lts_aut_t> >(l, lts_eq_divergence_preserving_branching_bisim, number_of_threads);
+    }
+  }
+}
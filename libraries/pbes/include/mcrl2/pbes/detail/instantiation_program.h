@@ -0,0 +1,310 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/pbes/detail/instantiation_program.h
+/// \brief Programs that instantiate the right hand sides of PBES equations.
+
+#ifndef MCRL2_PBES_DETAIL_INSTANTIATION_PROGRAM_H
+#define MCRL2_PBES_DETAIL_INSTANTIATION_PROGRAM_H
+
+#include <iterator>
+#include <vector>
+#include "mcrl2/data/detail/split_finite_variables.h"
+#include "mcrl2/data/optimized_boolean_operators.h"
+#include "mcrl2/data/substitutions/mutable_indexed_substitution.h"
+#include "mcrl2/pbes/find.h"
+#include "mcrl2/pbes/pbes_equation.h"
+#include "mcrl2/pbes/rewriters/enumerate_quantifiers_rewriter.h"
+#include "mcrl2/utilities/noncopyable.h"
+
+namespace mcrl2 {
+
+namespace pbes_system {
+
+namespace detail {
+
+/// \brief Instantiates the right hand sides of a sequence of PBES equations.
+/// \details The right hand side of every equation is compiled once into a program, i.e. a sequence of
+/// instructions in postfix order. Instantiating an equation for X(e) assigns the values e to the slots of the
+/// parameters in the substitution, and evaluates the program. The result is the same as that of applying the
+/// enumerate_quantifiers_rewriter to the right hand side. The boolean operators are evaluated with short
+/// circuiting, and the quantifier variables are split into enumerable and non-enumerable ones during
+/// compilation. The propositional variable instantiations in the result are emitted into a vector, in order
+/// of occurrence.
+class instantiation_program: private utilities::noncopyable
+{
+  public:
+    typedef data::mutable_indexed_substitution<> substitution_type;
+
+  protected:
+    typedef apply_enumerate_builder<enumerate_quantifiers_builder, data::rewriter, substitution_type> builder_type;
+
+    enum class opcode
+    {
+      constant,
+      data,
+      propositional_variable,
+      not_,
+      and_,
+      or_,
+      imp,
+      forall,
+      exists,
+      other
+    };
+
+    struct instruction
+    {
+      opcode op;
+
+      // The subterm of the right hand side that is computed by this instruction.
+      pbes_expression x;
+
+      // The instructions that compute the operands.
+      std::size_t left = 0;
+      std::size_t right = 0;
+
+      // For quantifiers, the variables that are eliminated by enumeration and the remaining ones. If
+      // enumerate is false, the body is only rewritten.
+      data::variable_list enumerated;
+      data::variable_list not_enumerated;
+      bool enumerate = true;
+
+      instruction(opcode op_, const pbes_expression& x_)
+        : op(op_), x(x_)
+      {}
+    };
+
+    struct equation_program
+    {
+      std::vector<data::variable> parameters;
+      std::vector<instruction> instructions;
+    };
+
+    const enumerate_quantifiers_rewriter& R;
+    substitution_type& sigma;
+    builder_type m_builder;
+    std::vector<equation_program> m_programs;
+
+    // Appends the instructions that compute x to p, and returns the index of the last one.
+    std::size_t compile(equation_program& p, const pbes_expression& x)
+    {
+      std::size_t left = 0;
+      std::size_t right = 0;
+      opcode op;
+      if (is_true(x) || is_false(x))
+      {
+        op = opcode::constant;
+      }
+      else if (is_data(x))
+      {
+        op = opcode::data;
+      }
+      else if (is_propositional_variable_instantiation(x))
+      {
+        op = opcode::propositional_variable;
+      }
+      else if (is_not(x))
+      {
+        op = opcode::not_;
+        left = compile(p, atermpp::down_cast<not_>(x).operand());
+      }
+      else if (is_and(x))
+      {
+        op = opcode::and_;
+        left = compile(p, atermpp::down_cast<and_>(x).left());
+        right = compile(p, atermpp::down_cast<and_>(x).right());
+      }
+      else if (is_or(x))
+      {
+        op = opcode::or_;
+        left = compile(p, atermpp::down_cast<or_>(x).left());
+        right = compile(p, atermpp::down_cast<or_>(x).right());
+      }
+      else if (is_imp(x))
+      {
+        op = opcode::imp;
+        left = compile(p, atermpp::down_cast<imp>(x).left());
+        right = compile(p, atermpp::down_cast<imp>(x).right());
+      }
+      else if (is_forall(x))
+      {
+        op = opcode::forall;
+      }
+      else if (is_exists(x))
+      {
+        op = opcode::exists;
+      }
+      else
+      {
+        op = opcode::other;
+      }
+
+      p.instructions.emplace_back(op, x);
+      instruction& instr = p.instructions.back();
+      instr.left = left;
+      instr.right = right;
+      if (op == opcode::forall || op == opcode::exists)
+      {
+        const data::variable_list& v = op == opcode::forall ? atermpp::down_cast<forall>(x).variables() : atermpp::down_cast<exists>(x).variables();
+        if (R.m_enumerate_infinite_sorts)
+        {
+          data::detail::split_enumerable_variables(v, R.m_dataspec, R.m_rewriter, instr.enumerated, instr.not_enumerated);
+        }
+        else
+        {
+          data::detail::split_finite_variables(v, R.m_dataspec, instr.enumerated, instr.not_enumerated);
+          instr.enumerate = !instr.enumerated.empty();
+        }
+      }
+      return p.instructions.size() - 1;
+    }
+
+    // Removes the instantiations that were emitted since mark if x is a constant, since it has no occurrences.
+    pbes_expression truncate(const pbes_expression& x, std::vector<propositional_variable_instantiation>& successors, std::size_t mark) const
+    {
+      if (is_true(x) || is_false(x))
+      {
+        successors.resize(mark);
+      }
+      return x;
+    }
+
+    pbes_expression evaluate(const equation_program& p, std::size_t i, std::vector<propositional_variable_instantiation>& successors)
+    {
+      const instruction& instr = p.instructions[i];
+      std::size_t mark = successors.size();
+      switch (instr.op)
+      {
+        case opcode::constant:
+        {
+          return instr.x;
+        }
+        case opcode::data:
+        {
+          return R.m_rewriter(atermpp::down_cast<data::data_expression>(instr.x), sigma);
+        }
+        case opcode::propositional_variable:
+        {
+          const propositional_variable_instantiation& X = atermpp::down_cast<propositional_variable_instantiation>(instr.x);
+          const data::data_expression_list& e = X.parameters();
+          successors.emplace_back(X.name(), data::data_expression_list(e.begin(), e.end(), [&](const data::data_expression& x) { return R.m_rewriter(x, sigma); }));
+          return successors.back();
+        }
+        case opcode::not_:
+        {
+          return data::optimized_not(evaluate(p, instr.left, successors));
+        }
+        case opcode::and_:
+        {
+          pbes_expression left = evaluate(p, instr.left, successors);
+          if (is_false(left))
+          {
+            return left;
+          }
+          return truncate(data::optimized_and(left, evaluate(p, instr.right, successors)), successors, mark);
+        }
+        case opcode::or_:
+        {
+          pbes_expression left = evaluate(p, instr.left, successors);
+          if (is_true(left))
+          {
+            return left;
+          }
+          return truncate(data::optimized_or(left, evaluate(p, instr.right, successors)), successors, mark);
+        }
+        case opcode::imp:
+        {
+          pbes_expression left = evaluate(p, instr.left, successors);
+          if (is_false(left))
+          {
+            return true_();
+          }
+          return truncate(data::optimized_imp(left, evaluate(p, instr.right, successors)), successors, mark);
+        }
+        default:
+        {
+          pbes_expression result = evaluate_other(instr);
+          pbes_system::find_propositional_variable_instantiations(result, std::back_inserter(successors));
+          return result;
+        }
+      }
+    }
+
+    // Evaluates quantifiers, as in enumerate_quantifiers_builder but with the quantifier variables split in advance,
+    // and all other expressions.
+    pbes_expression evaluate_other(const instruction& instr)
+    {
+      if (instr.op == opcode::forall)
+      {
+        const pbes_expression& body = atermpp::down_cast<forall>(instr.x).body();
+        if (!instr.enumerate)
+        {
+          return data::optimized_forall(instr.not_enumerated, m_builder.apply(body));
+        }
+        return data::optimized_forall_no_empty_domain(instr.not_enumerated, m_builder.enumerate_forall(instr.enumerated, body));
+      }
+      else if (instr.op == opcode::exists)
+      {
+        const pbes_expression& body = atermpp::down_cast<exists>(instr.x).body();
+        if (!instr.enumerate)
+        {
+          return data::optimized_exists(instr.not_enumerated, m_builder.apply(body));
+        }
+        return data::optimized_exists_no_empty_domain(instr.not_enumerated, m_builder.enumerate_exists(instr.enumerated, body));
+      }
+      return m_builder.apply(instr.x);
+    }
+
+  public:
+    /// \brief Constructor.
+    /// \param equations The PBES equations, which must not contain global variables.
+    /// \param R_ The rewriter of which the result is computed.
+    /// \param sigma_ A substitution that is applied during instantiation, in addition to the parameter values.
+    instantiation_program(const std::vector<pbes_equation>& equations, const enumerate_quantifiers_rewriter& R_, substitution_type& sigma_)
+      : R(R_),
+        sigma(sigma_),
+        m_builder(R.m_rewriter, sigma, R.m_dataspec, R.m_id_generator, R.m_enumerate_infinite_sorts)
+    {
+      m_programs.resize(equations.size());
+      for (std::size_t i = 0; i < equations.size(); i++)
+      {
+        const data::variable_list& parameters = equations[i].variable().parameters();
+        m_programs[i].parameters.assign(parameters.begin(), parameters.end());
+        compile(m_programs[i], equations[i].formula());
+      }
+    }
+
+    /// \brief Returns the rewritten right hand side of the equation with index i, instantiated for X_e.
+    /// \param successors The propositional variable instantiations in the result are appended to successors, in
+    /// order of occurrence and possibly with duplicates.
+    pbes_expression operator()(std::size_t i, const propositional_variable_instantiation& X_e, std::vector<propositional_variable_instantiation>& successors)
+    {
+      const equation_program& p = m_programs[i];
+      auto e = X_e.parameters().begin();
+      for (const data::variable& v: p.parameters)
+      {
+        sigma[v] = *e++;
+      }
+      R.m_id_generator.clear();
+      pbes_expression result = evaluate(p, p.instructions.size() - 1, successors);
+      for (const data::variable& v: p.parameters)
+      {
+        sigma[v] = v;
+      }
+      return result;
+    }
+};
+
+} // namespace detail
+
+} // namespace pbes_system
+
+} // namespace mcrl2
+
+#endif // MCRL2_PBES_DETAIL_INSTANTIATION_PROGRAM_H
@@ -18,6 +18,7 @@
 #include "mcrl2/pbes/detail/bes_equation_limit.h"
 #include "mcrl2/pbes/detail/check_well_formed_bes.h"
 #include "mcrl2/pbes/detail/instantiate_global_variables.h"
+#include "mcrl2/pbes/detail/instantiation_program.h"
 #include "mcrl2/pbes/find.h"
 #include "mcrl2/pbes/fixpoint_symbol.h"
 #include "mcrl2/pbes/pbes.h"
@@ -29,6 +30,7 @@
 #include <ctime>
 #include <deque>
 #include <iostream>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <stack>
@@ -211,6 +213,16 @@ class pbesinst_alternative_lazy_algorithm
     /// \brief Transformation strategy.
     transformation_strategy m_transformation_strategy;
 
+    /// \brief If true, the right hand sides of the equations are compiled into programs that are used for
+    ///        instantiation.
+    bool m_compile_equations;
+
+    /// \brief The substitution that is used by m_program.
+    data::mutable_indexed_substitution<> m_program_sigma;
+
+    /// \brief The compiled right hand sides of the equations.
+    std::unique_ptr<detail::instantiation_program> m_program;
+
     /// \brief Prints a log message for every 1000-th equation
     void print_equation_count(const std::size_t nr_of_processed_variables,
                               const std::size_t nr_of_generated_variables,
@@ -248,6 +260,8 @@ class pbesinst_alternative_lazy_algorithm
     ///                          true or false, depending on the parameter \p approximate_true.
     /// \param approximate_true If true BES variables that are not investigated are set to false. If false
     ///                         these variables are set to true.
+    /// \param compile_equations If true, the right hand sides of the equations are compiled once into programs
+    ///                          that are used to instantiate them.
     pbesinst_alternative_lazy_algorithm(
         const data::data_specification& data_spec,
         const data::rewriter& datar,
@@ -255,7 +269,8 @@ class pbesinst_alternative_lazy_algorithm
         transformation_strategy transformation_strategy = lazy,
         const mcrl2::bes::remove_level erase_unused_bes_variables = mcrl2::bes::none,
         const std::size_t maximum_todo_size = atermpp::npos,
-        const bool approximate_true = true
+        const bool approximate_true = true,
+        const bool compile_equations = false
         )
       :
         m_data_spec(data_spec),
@@ -266,7 +281,8 @@ class pbesinst_alternative_lazy_algorithm
         m_elements_not_stored_in_todo_buffer(0),
         m_erase_unused_bes_variables(erase_unused_bes_variables),
         m_search_strategy(search_strategy),
-        m_transformation_strategy(transformation_strategy)
+        m_transformation_strategy(transformation_strategy),
+        m_compile_equations(compile_equations)
     {
       // Initialize the random generator, with an arbitrary seed, depending on a new time.
       time_t t=time(nullptr);
@@ -602,6 +618,11 @@ class pbesinst_alternative_lazy_algorithm
         ++eqn_index;
       }
 
+      if (m_compile_equations)
+      {
+        m_program.reset(new detail::instantiation_program(pbes_equations, R, m_program_sigma));
+      }
+
       init = atermpp::down_cast<propositional_variable_instantiation>(R(p.initial_state()));
       add_todo(init);
       while (!todo.empty())
@@ -611,10 +632,20 @@ class pbesinst_alternative_lazy_algorithm
         instantiations[index].push_back(X_e);
 
         const pbes_equation& eqn = pbes_equations[index];
-        data::rewriter::substitution_type sigma;
-        make_pbesinst_substitution(eqn.variable().parameters(), X_e.parameters(), sigma);
-        const pbes_expression& phi = eqn.formula();
-        pbes_expression psi_e = R(phi, sigma);
+        std::vector<propositional_variable_instantiation> psi_variables;
+        pbes_expression psi_e;
+        if (m_program)
+        {
+          psi_e = (*m_program)(index, X_e, psi_variables);
+        }
+        else
+        {
+          data::rewriter::substitution_type sigma;
+          make_pbesinst_substitution(eqn.variable().parameters(), X_e.parameters(), sigma);
+          const pbes_expression& phi = eqn.formula();
+          psi_e = R(phi, sigma);
+        }
+        const pbes_expression instantiated_psi_e = psi_e;
         try
         {
           check_whether_argument_is_a_well_formed_bes(psi_e);
@@ -661,7 +692,12 @@ class pbesinst_alternative_lazy_algorithm
 
         // Add all variable instantiations in psi_e to todo and generated,
         // and augment the occurrence sets
-        std::set<propositional_variable_instantiation> psi_variables = find_propositional_variable_instantiations(psi_e);
+        // The variable instantiations that were emitted by m_program can be used if psi_e was not changed.
+        if (!m_program || psi_e != instantiated_psi_e)
+        {
+          std::set<propositional_variable_instantiation> variables = find_propositional_variable_instantiations(psi_e);
+          psi_variables.assign(variables.begin(), variables.end());
+        }
         for (const propositional_variable_instantiation& v: psi_variables)
         {
           if (todo_set.count(v) == 0 && equation.count(v) == 0)
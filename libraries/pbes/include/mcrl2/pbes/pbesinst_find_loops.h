@@ -74,7 +74,7 @@ bool find_loop(const simple_structure_graph& G,
 
 inline
 void find_loops(const simple_structure_graph& G,
-                const std::unordered_set<propositional_variable_instantiation>& discovered,
+                const utilities::indexed_set<propositional_variable_instantiation>& discovered,
                 const pbesinst_lazy_todo& todo,
                 std::array<vertex_set, 2>& S,
                 std::array<strategy_vector, 2>& tau,
@@ -9,19 +9,27 @@
 /// \file mcrl2/pbes/pbesinst_lazy_algorithm.h
 /// \brief A lazy algorithm for instantiating a PBES, ported from bes_deprecated.h.
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <exception>
+#include <memory>
 #include <set>
 #include <deque>
 #include <stack>
 #include <iostream>
+#include <iterator>
 #include <sstream>
+#include <thread>
 #include <unordered_set>
 #include <unordered_map>
+#include "mcrl2/atermpp/thread_aterm_pool.h"
 #include "mcrl2/core/detail/print_utility.h"
 #include "mcrl2/data/rewriter.h"
 #include "mcrl2/data/substitution_utility.h"
 #include "mcrl2/pbes/detail/bes_equation_limit.h"
 #include "mcrl2/pbes/detail/instantiate_global_variables.h"
+#include "mcrl2/pbes/detail/instantiation_program.h"
 #include "mcrl2/pbes/pbes_equation_index.h"
 #include "mcrl2/pbes/pbessolve_options.h"
 #include "mcrl2/pbes/remove_equations.h"
@@ -35,6 +43,7 @@
 #include "mcrl2/pbes/transformation_strategy.h"
 #include "mcrl2/pbes/transformations.h"
 #include "mcrl2/utilities/detail/container_utility.h"
+#include "mcrl2/utilities/indexed_set.h"
 #include "mcrl2/utilities/text_utility.h"
 
 #ifndef MCRL2_PBES_PBESINST_LAZY_H
@@ -129,10 +138,8 @@ class pbesinst_lazy_todo
     }
 
     template <typename FwdIter>
-    void insert(FwdIter first, FwdIter last, const std::unordered_set<propositional_variable_instantiation>& discovered)
+    void insert(FwdIter first, FwdIter last, const utilities::indexed_set<propositional_variable_instantiation>& discovered)
     {
-      using utilities::detail::contains;
-
       for (FwdIter i = first; i != last; ++i)
       {
         auto j = irrelevant.find(*i);
@@ -141,7 +148,7 @@ class pbesinst_lazy_todo
           todo.push_back(*j);
           irrelevant.erase(j);
         }
-        else if (!contains(discovered, *i))
+        else if (!discovered.contains(*i))
         {
           todo.push_back(*i);
         }
@@ -202,7 +209,7 @@ class pbesinst_lazy_algorithm
     pbesinst_lazy_todo todo;
 
     /// \brief The propositional variable instantiations that have been discovered (not necessarily handled).
-    std::unordered_set<propositional_variable_instantiation> discovered;
+    utilities::indexed_set<propositional_variable_instantiation> discovered;
 
     /// \brief The initial value (after rewriting).
     propositional_variable_instantiation init;
@@ -210,6 +217,45 @@ class pbesinst_lazy_algorithm
     // \brief The number of iterations
     std::size_t m_iteration_count = 0;
 
+    /// \brief The compiled right hand sides of the equations, if options.compile_equations is set. It is only
+    /// available during run.
+    std::unique_ptr<detail::instantiation_program> m_program;
+
+    /// \brief A rewriter and substitution that are used by one of the additional threads of a multi-threaded
+    /// instantiation.
+    struct instantiation_worker
+    {
+      data::rewriter datar;
+      enumerate_quantifiers_rewriter R;
+      data::mutable_indexed_substitution<> sigma;
+      std::unique_ptr<detail::instantiation_program> program;
+
+      instantiation_worker(const pbessolve_options& options, const pbes& p)
+        : datar(p.data(), data::used_data_equation_selector(p.data(), pbes_system::find_function_symbols(p), p.global_variables()), options.rewrite_strategy),
+          R(datar, p.data())
+      {}
+    };
+
+    /// \brief The right hand side of the equation of X, as computed by one of the threads of a multi-threaded
+    /// instantiation.
+    struct instantiated_equation
+    {
+      propositional_variable_instantiation X;
+      pbes_expression psi;
+      std::vector<propositional_variable_instantiation> successors;
+      std::exception_ptr error;
+
+      explicit instantiated_equation(const propositional_variable_instantiation& X_)
+        : X(X_)
+      {}
+    };
+
+    /// \brief The workers of a multi-threaded instantiation.
+    std::vector<std::unique_ptr<instantiation_worker>> m_workers;
+
+    /// \brief Right hand sides that have been computed in advance by a multi-threaded instantiation.
+    std::unordered_map<propositional_variable_instantiation, instantiated_equation> m_instantiated;
+
     /// \brief Prints a log message for every 1000-th equation
     std::string print_equation_count(std::size_t size) const
     {
@@ -237,6 +283,126 @@ class pbesinst_lazy_algorithm
       return p;
     }
 
+    // Returns the rewritten right hand side of the equation of X_e, using the rewriter R and substitution sigma, or
+    // the compiled equations in program if it is set. In the latter case the propositional variable instantiations
+    // of the result are appended to successors.
+    pbes_expression instantiate(enumerate_quantifiers_rewriter& R_,
+                                data::mutable_indexed_substitution<>& sigma,
+                                detail::instantiation_program* program,
+                                const propositional_variable_instantiation& X_e,
+                                std::vector<propositional_variable_instantiation>& successors
+                               ) const
+    {
+      std::size_t index = m_equation_index.index(X_e.name());
+      if (program)
+      {
+        return (*program)(index, X_e, successors);
+      }
+      const pbes_equation& eqn = m_pbes.equations()[index];
+      data::add_assignments(sigma, eqn.variable().parameters(), X_e.parameters());
+      pbes_expression psi_e = R_(eqn.formula(), sigma);
+      data::remove_assignments(sigma, eqn.variable().parameters());
+      return psi_e;
+    }
+
+    // Computes the right hand sides of the equations in todo_, using the main rewriter and all workers. An
+    // exception is stored in the corresponding element, such that it can be rethrown when it is reported.
+    void instantiate_parallel(std::vector<instantiated_equation>& todo_, data::mutable_indexed_substitution<>& sigma)
+    {
+      std::atomic<std::size_t> next(0);
+      auto instantiate_equations = [&](enumerate_quantifiers_rewriter& R_, data::mutable_indexed_substitution<>& sigma_, detail::instantiation_program* program)
+      {
+        for (std::size_t i = next++; i < todo_.size(); i = next++)
+        {
+          try
+          {
+            todo_[i].psi = instantiate(R_, sigma_, program, todo_[i].X, todo_[i].successors);
+          }
+          catch (...)
+          {
+            todo_[i].error = std::current_exception();
+          }
+        }
+      };
+
+      std::vector<std::thread> threads;
+      for (std::size_t i = 0; i < m_workers.size() && i + 1 < todo_.size(); i++)
+      {
+        instantiation_worker* worker = m_workers[i].get();
+        threads.emplace_back([&instantiate_equations, worker]()
+          {
+            atermpp::thread_aterm_pool_registration registration;
+            instantiate_equations(worker->R, worker->sigma, worker->program.get());
+          }
+        );
+      }
+      instantiate_equations(R, sigma, m_program.get());
+
+      atermpp::thread_aterm_pool_idle idle;
+      for (std::thread& thread: threads)
+      {
+        thread.join();
+      }
+    }
+
+    // Returns the rewritten right hand side of the equation of X_e, which has just been removed from the todo list.
+    // In a multi-threaded breadth-first instantiation, the right hand sides of X_e and the elements at the front of
+    // the todo list are computed in parallel, and stored until they are handled. Since the elements remain in the
+    // todo list until then, the hooks that inspect or modify the todo list see the same todo list as in a
+    // sequential run, and the equations are reported in the same order.
+    pbes_expression instantiate_todo(const propositional_variable_instantiation& X_e,
+                                     data::mutable_indexed_substitution<>& sigma,
+                                     std::vector<propositional_variable_instantiation>& successors
+                                    )
+    {
+      if (m_workers.empty() || m_options.exploration_strategy != breadth_first)
+      {
+        return instantiate(R, sigma, m_program.get(), X_e, successors);
+      }
+
+      auto i = m_instantiated.find(X_e);
+      if (i == m_instantiated.end())
+      {
+        // The number of equations that is instantiated in one parallel round.
+        const std::size_t chunk_size = 64 * (m_workers.size() + 1);
+        std::vector<instantiated_equation> chunk;
+        chunk.emplace_back(X_e);
+        for (const propositional_variable_instantiation& Y: todo.elements())
+        {
+          if (chunk.size() == chunk_size)
+          {
+            break;
+          }
+          chunk.emplace_back(Y);
+        }
+        instantiate_parallel(chunk, sigma);
+
+        // Results of elements that have been removed from the todo list in the meantime are discarded.
+        m_instantiated.clear();
+        for (instantiated_equation& x: chunk)
+        {
+          m_instantiated.emplace(x.X, std::move(x));
+        }
+        i = m_instantiated.find(X_e);
+      }
+
+      instantiated_equation result = std::move(i->second);
+      m_instantiated.erase(i);
+      if (result.error)
+      {
+        std::rethrow_exception(result.error);
+      }
+      successors = std::move(result.successors);
+      return result.psi;
+    }
+
+    // Removes duplicates from v, and keeps the first occurrences in their order.
+    static void remove_duplicates(std::vector<propositional_variable_instantiation>& v)
+    {
+      std::unordered_set<propositional_variable_instantiation> seen;
+      v.erase(std::remove_if(v.begin(), v.end(), [&](const propositional_variable_instantiation& X) { return !seen.insert(X).second; }), v.end());
+    }
+
     pbes_expression rewrite_true_false(const fixpoint_symbol& symbol,
                                        const propositional_variable_instantiation& X,
                                        const pbes_expression& psi
@@ -288,7 +454,22 @@ class pbesinst_lazy_algorithm
        m_pbes(preprocess(p)),
        m_equation_index(p),
        R(datar, p.data())
-    { }
+    {
+      if (m_options.number_of_threads > 1)
+      {
+        if (atermpp::detail::GlobalThreadSafe)
+        {
+          for (std::size_t i = 1; i < m_options.number_of_threads; i++)
+          {
+            m_workers.emplace_back(new instantiation_worker(options, p));
+          }
+        }
+        else
+        {
+          mCRL2log(log::warning) << "Multi-threaded instantiation requires a toolset that is built with MCRL2_ENABLE_MULTITHREADING; the equations are instantiated by one thread." << std::endl;
+        }
+      }
+    }
 
     virtual ~pbesinst_lazy_algorithm() = default;
 
@@ -298,7 +479,8 @@ class pbesinst_lazy_algorithm
     { }
 
     /// \brief This function is called when new elements are added to discovered.
-    virtual void on_discovered_elements(const std::set<propositional_variable_instantiation>& /* elements */)
+    /// \param elements The propositional variable instantiations of the last reported equation, without duplicates.
+    virtual void on_discovered_elements(const std::vector<propositional_variable_instantiation>& /* elements */)
     { }
 
     /// \brief This function is called right after the while loop is finished.
@@ -352,6 +534,21 @@ class pbesinst_lazy_algorithm
         pbes_system::replace_constants_by_variables(m_pbes, datar, sigma);
       }
 
+      for (std::unique_ptr<instantiation_worker>& worker: m_workers)
+      {
+        worker->sigma = sigma;
+        if (m_options.compile_equations)
+        {
+          worker->program.reset(new detail::instantiation_program(m_pbes.equations(), worker->R, worker->sigma));
+        }
+      }
+      if (m_options.compile_equations)
+      {
+        m_program.reset(new detail::instantiation_program(m_pbes.equations(), R, sigma));
+      }
+      m_instantiated.clear();
+      std::vector<propositional_variable_instantiation> occ;
+
       init = atermpp::down_cast<propositional_variable_instantiation>(R(m_pbes.initial_state(), sigma));
       todo.insert(init);
       discovered.insert(init);
@@ -364,22 +561,38 @@ class pbesinst_lazy_algorithm
         propositional_variable_instantiation X_e = next_todo();
         std::size_t index = m_equation_index.index(X_e.name());
         const pbes_equation& eqn = m_pbes.equations()[index];
-        const auto& phi = eqn.formula();
-        data::add_assignments(sigma, eqn.variable().parameters(), X_e.parameters());
-        pbes_expression psi_e = R(phi, sigma);
-        data::remove_assignments(sigma, eqn.variable().parameters());
+        occ.clear();
+        pbes_expression psi_e = instantiate_todo(X_e, sigma, occ);
 
         // optional step
-        psi_e = rewrite_psi(eqn.symbol(), X_e, psi_e);
+        pbes_expression psi_e1 = rewrite_psi(eqn.symbol(), X_e, psi_e);
+        bool rewritten = psi_e1 != psi_e;
+        psi_e = psi_e1;
 
         // report the generated equation
         std::size_t k = m_equation_index.rank(X_e.name());
         mCRL2log(log::debug) << "generated equation " << X_e << " = " << psi_e << " with rank " << k << std::endl;
         on_report_equation(X_e, psi_e, k);
 
-        std::set<propositional_variable_instantiation> occ = find_propositional_variable_instantiations(psi_e);
+        if (!m_program)
+        {
+          std::set<propositional_variable_instantiation> occ_set = find_propositional_variable_instantiations(psi_e);
+          occ.assign(occ_set.begin(), occ_set.end());
+        }
+        else
+        {
+          if (rewritten)
+          {
+            occ.clear();
+            find_propositional_variable_instantiations(psi_e, std::back_inserter(occ));
+          }
+          remove_duplicates(occ);
+        }
         todo.insert(occ.begin(), occ.end(), discovered);
-        discovered.insert(occ.begin(), occ.end());
+        for (const propositional_variable_instantiation& Y: occ)
+        {
+          discovered.insert(Y);
+        }
         on_discovered_elements(occ);
 
         if (solution_found(init))
@@ -387,6 +600,12 @@ class pbesinst_lazy_algorithm
           break;
         }
       }
+      m_instantiated.clear();
+      m_program.reset();
+      for (std::unique_ptr<instantiation_worker>& worker: m_workers)
+      {
+        worker->program.reset();
+      }
       on_end_while_loop();
     }
 
@@ -513,7 +513,7 @@ class pbesinst_structure_graph_algorithm2: public pbesinst_structure_graph_algor
       }
     }
 
-    void on_discovered_elements(const std::set<propositional_variable_instantiation>& elements) override
+    void on_discovered_elements(const std::vector<propositional_variable_instantiation>& elements) override
     {
       using utilities::detail::contains;
 
@@ -12,7 +12,10 @@
 #ifndef MCRL2_PBES_PBESSOLVE_ATTRACTORS_H
 #define MCRL2_PBES_PBESSOLVE_ATTRACTORS_H
 
+#include <atomic>
+#include <boost/range/distance.hpp>
 #include "mcrl2/pbes/pbessolve_vertex_set.h"
+#include "mcrl2/utilities/parallel_for.h"
 
 namespace mcrl2 {
 
@@ -184,6 +187,156 @@ vertex_set attr_default_with_tau(const StructureGraph& G, vertex_set A, std::siz
   return attr_default_generic(G, A, alpha, global_local_strategy<StructureGraph>(G, tau, alpha));
 }
 
+// Computes attractor sets using multiple threads.
+// The vertices are added in rounds. In each round the predecessors of the vertices that were added in the
+// previous round are examined in parallel, using an atomic counter per vertex for the number of successors
+// that are not yet in the attractor set. The strategy of a new vertex is its first successor that was in the
+// attractor set at the end of the previous round, and the new vertices of a round are added in increasing order.
+// Hence the result does not depend on the number of threads, or on the scheduling of the threads. The attractor
+// sets are the same as those of attr_default_generic, but the strategies may differ.
+class parallel_attractor
+{
+  protected:
+    typedef structure_graph::index_type index_type;
+
+    // The vertices of a round are split over the threads in blocks of at least this size.
+    static const std::size_t minimal_block_size = 256;
+
+    std::size_t m_number_of_threads;
+
+    // m_counters[v] contains the number of successors of v that are not in the attractor set, or undefined_vertex()
+    // if this number has not been computed yet. For vertices of player alpha it is 0 once they have been added.
+    std::vector<std::atomic<index_type>> m_counters;
+
+    // Per thread, the vertices that are added in the current round, and the vertices of which the counter was changed.
+    std::vector<std::vector<index_type>> m_added;
+    std::vector<std::vector<index_type>> m_touched;
+
+    void initialize(std::size_t N)
+    {
+      if (m_counters.size() != N)
+      {
+        std::vector<std::atomic<index_type>>(N).swap(m_counters);
+        for (std::atomic<index_type>& counter: m_counters)
+        {
+          counter.store(undefined_vertex(), std::memory_order_relaxed);
+        }
+      }
+    }
+
+    std::size_t number_of_threads(std::size_t n) const
+    {
+      return std::min(m_number_of_threads, 1 + n / minimal_block_size);
+    }
+
+    // Examines the predecessors of the vertices frontier[begin], ..., frontier[end - 1] in thread t.
+    template <typename StructureGraph>
+    void examine_predecessors(const StructureGraph& G, const vertex_set& A, std::size_t alpha, const std::vector<index_type>& frontier, std::size_t t, std::size_t begin, std::size_t end)
+    {
+      for (std::size_t i = begin; i < end; i++)
+      {
+        index_type u = frontier[i];
+        if (!G.contains(u))
+        {
+          continue;
+        }
+        for (index_type v: G.predecessors(u))
+        {
+          if (A.contains(v))
+          {
+            continue;
+          }
+          std::atomic<index_type>& counter = m_counters[v];
+          if (G.decoration(v) == alpha)
+          {
+            if (counter.exchange(0) != 0)
+            {
+              m_added[t].push_back(v);
+              m_touched[t].push_back(v);
+            }
+          }
+          else
+          {
+            index_type expected = undefined_vertex();
+            if (counter.load() == expected)
+            {
+              index_type count = boost::distance(G.successors(v));
+              if (counter.compare_exchange_strong(expected, count))
+              {
+                m_touched[t].push_back(v);
+              }
+            }
+            if (counter.fetch_sub(1) == 1)
+            {
+              m_added[t].push_back(v);
+            }
+          }
+        }
+      }
+    }
+
+  public:
+    explicit parallel_attractor(std::size_t number_of_threads)
+      : m_number_of_threads(number_of_threads),
+        m_added(number_of_threads),
+        m_touched(number_of_threads)
+    {}
+
+    // alpha = 0: disjunctive
+    // alpha = 1: conjunctive
+    // Strategy is either no_strategy, global_strategy, local_strategy or global_local_strategy
+    template <typename StructureGraph, typename Strategy>
+    vertex_set operator()(const StructureGraph& G, vertex_set A, std::size_t alpha, Strategy tau)
+    {
+      initialize(G.extent());
+      std::vector<index_type> frontier = A.vertices();
+      std::vector<index_type> strategy;
+
+      while (!frontier.empty())
+      {
+        utilities::parallel_for_blocks(frontier.size(), number_of_threads(frontier.size()),
+          [&](std::size_t t, std::size_t begin, std::size_t end)
+          {
+            examine_predecessors(G, A, alpha, frontier, t, begin, end);
+          });
+
+        frontier.clear();
+        for (std::vector<index_type>& added: m_added)
+        {
+          frontier.insert(frontier.end(), added.begin(), added.end());
+          added.clear();
+        }
+        std::sort(frontier.begin(), frontier.end());
+
+        strategy.resize(frontier.size());
+        utilities::parallel_for_blocks(frontier.size(), number_of_threads(frontier.size()),
+          [&](std::size_t /* t */, std::size_t begin, std::size_t end)
+          {
+            for (std::size_t i = begin; i < end; i++)
+            {
+              strategy[i] = find_successor_in(G, frontier[i], A);
+            }
+          });
+
+        for (std::size_t i = 0; i < frontier.size(); i++)
+        {
+          tau.set_strategy(frontier[i], strategy[i]);
+          A.insert(frontier[i]);
+        }
+      }
+
+      for (std::vector<index_type>& touched: m_touched)
+      {
+        for (index_type v: touched)
+        {
+          m_counters[v].store(undefined_vertex(), std::memory_order_relaxed);
+        }
+        touched.clear();
+      }
+      return A;
+    }
+};
+
 } // namespace pbes_system
 
 } // namespace mcrl2
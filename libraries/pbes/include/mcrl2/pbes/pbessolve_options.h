@@ -36,6 +36,12 @@ struct pbessolve_options
   bool check_strategy = false;
 
   bool prune_todo_alternative = false;
+
+  // if true, the right hand sides of the equations are compiled into programs that are used for instantiation
+  bool compile_equations = false;
+
+  // the number of threads that is used for instantiating the pbes and for solving the structure graph
+  std::size_t number_of_threads = 1;
 };
 
 inline
@@ -49,6 +55,8 @@ std::ostream& operator<<(std::ostream& out, const pbessolve_options& options)
   out << "aggressive = " << std::boolalpha << options.aggressive << std::endl;
   out << "check-strategy = " << std::boolalpha << options.check_strategy << std::endl;
   out << "prune-todo-alternative = " << std::boolalpha << options.prune_todo_alternative << std::endl;
+  out << "compile-equations = " << std::boolalpha << options.compile_equations << std::endl;
+  out << "threads = " << options.number_of_threads << std::endl;
   return out;
 }
 
@@ -18,6 +18,7 @@
 #include <utility>
 #include <boost/dynamic_bitset.hpp>
 #include <boost/range/adaptor/filtered.hpp>
+#include <boost/range/iterator_range.hpp>
 #include "mcrl2/core/detail/print_utility.h"
 #include "mcrl2/data/undefined.h"
 #include "mcrl2/pbes/pbes.h"
@@ -61,6 +62,9 @@ unsigned int undefined_vertex()
 
 // A structure graph with a facility to exclude a subset of the vertices.
 // It has the same interface as simple_structure_graph.
+// During construction the predecessors and successors are stored in the vertices. Before solving,
+// the graph can be frozen, which moves all edges into two flat arrays in compressed sparse row
+// format. This removes the overhead of two vectors per vertex.
 class structure_graph
 {
   friend struct detail::structure_graph_builder;
@@ -78,6 +82,9 @@ class structure_graph
 
     using index_type = unsigned int;
 
+    // A range of predecessors or successors of a vertex
+    using index_range = boost::iterator_range<const index_type*>;
+
     // TODO: when using the CMake build, this declaration causes strange linker errors
     // static constexpr index_type undefined_vertex = (std::numeric_limits<index_type>::max)();
 
@@ -127,6 +134,46 @@ class structure_graph
     index_type m_initial_vertex = 0;
     boost::dynamic_bitset<> m_exclude;
 
+    // If m_frozen is true, the successors of vertex u are stored in m_successors at the positions
+    // m_successor_offsets[u], ..., m_successor_offsets[u + 1] - 1, and similarly for the predecessors.
+    // In that case the predecessors and successors attributes of the vertices are empty.
+    bool m_frozen = false;
+    std::vector<std::size_t> m_successor_offsets;
+    std::vector<index_type> m_successors;
+    std::vector<std::size_t> m_predecessor_offsets;
+    std::vector<index_type> m_predecessors;
+
+    static index_range make_index_range(const std::vector<index_type>& v)
+    {
+      return index_range(v.data(), v.data() + v.size());
+    }
+
+    static index_range make_index_range(const std::vector<index_type>& v, const std::vector<std::size_t>& offsets, index_type u)
+    {
+      return index_range(v.data() + offsets[u], v.data() + offsets[u + 1]);
+    }
+
+    // Moves the elements of the vectors (m_vertices[u].*member) into result, and computes the offsets.
+    // The vectors of the vertices are released one by one, to limit the peak memory usage.
+    void move_edges(std::vector<index_type> vertex::* member, std::vector<std::size_t>& offsets, std::vector<index_type>& result)
+    {
+      std::size_t N = m_vertices.size();
+      offsets.resize(N + 1);
+      offsets[0] = 0;
+      for (std::size_t u = 0; u < N; u++)
+      {
+        offsets[u + 1] = offsets[u] + (m_vertices[u].*member).size();
+      }
+      result.clear();
+      result.reserve(offsets[N]);
+      for (vertex& u: m_vertices)
+      {
+        std::vector<index_type>& V = u.*member;
+        result.insert(result.end(), V.begin(), V.end());
+        std::vector<index_type>().swap(V);
+      }
+    }
+
     struct integers_not_contained_in
     {
       const boost::dynamic_bitset<>& subset;
@@ -192,14 +239,14 @@ class structure_graph
       return m_vertices;
     }
 
-    const std::vector<index_type>& all_predecessors(index_type u) const
+    index_range all_predecessors(index_type u) const
     {
-      return m_vertices[u].predecessors;
+      return m_frozen ? make_index_range(m_predecessors, m_predecessor_offsets, u) : make_index_range(m_vertices[u].predecessors);
     }
 
-    const std::vector<index_type>& all_successors(index_type u) const
+    index_range all_successors(index_type u) const
     {
-      return m_vertices[u].successors;
+      return m_frozen ? make_index_range(m_successors, m_successor_offsets, u) : make_index_range(m_vertices[u].successors);
     }
 
     boost::filtered_range<vertices_not_contained_in, const std::vector<vertex>> vertices() const
@@ -207,12 +254,12 @@ class structure_graph
       return all_vertices() | boost::adaptors::filtered(vertices_not_contained_in(m_vertices, m_exclude));
     }
 
-    boost::filtered_range<integers_not_contained_in, const std::vector<index_type>> predecessors(index_type u) const
+    boost::filtered_range<integers_not_contained_in, const index_range> predecessors(index_type u) const
     {
       return all_predecessors(u) | boost::adaptors::filtered(integers_not_contained_in(m_exclude));
     }
 
-    boost::filtered_range<integers_not_contained_in, const std::vector<index_type>> successors(index_type u) const
+    boost::filtered_range<integers_not_contained_in, const index_range> successors(index_type u) const
     {
       return all_successors(u) | boost::adaptors::filtered(integers_not_contained_in(m_exclude));
     }
@@ -258,7 +305,57 @@ class structure_graph
     // Returns true if all vertices have a rank and a decoration
     bool is_defined() const
     {
-      return std::all_of(m_vertices.begin(), m_vertices.end(), [](const vertex& u) { return u.is_defined(); });
+      for (std::size_t u = 0; u < m_vertices.size(); u++)
+      {
+        const vertex& u_ = m_vertices[u];
+        bool defined = ((u_.decoration != d_none) || (u_.rank != data::undefined_index()))
+                    && (!all_successors(u).empty() || (u_.decoration == d_true || u_.decoration == d_false));
+        if (!defined)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    bool is_frozen() const
+    {
+      return m_frozen;
+    }
+
+    /// \brief Moves the predecessors and successors of all vertices into flat arrays.
+    /// \details Afterwards the edges can only be accessed via all_predecessors, all_successors,
+    /// predecessors and successors, and the graph can no longer be modified by a structure_graph_builder.
+    void freeze()
+    {
+      if (m_frozen)
+      {
+        return;
+      }
+      move_edges(&vertex::successors, m_successor_offsets, m_successors);
+      move_edges(&vertex::predecessors, m_predecessor_offsets, m_predecessors);
+      m_frozen = true;
+    }
+
+    /// \brief Moves the predecessors and successors back into the vertices, which undoes freeze().
+    void unfreeze()
+    {
+      if (!m_frozen)
+      {
+        return;
+      }
+      for (std::size_t u = 0; u < m_vertices.size(); u++)
+      {
+        index_range pred = all_predecessors(u);
+        index_range succ = all_successors(u);
+        m_vertices[u].predecessors.assign(pred.begin(), pred.end());
+        m_vertices[u].successors.assign(succ.begin(), succ.end());
+      }
+      m_frozen = false;
+      std::vector<std::size_t>().swap(m_successor_offsets);
+      std::vector<index_type>().swap(m_successors);
+      std::vector<std::size_t>().swap(m_predecessor_offsets);
+      std::vector<index_type>().swap(m_predecessors);
     }
 };
 
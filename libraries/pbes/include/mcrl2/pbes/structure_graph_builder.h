@@ -38,8 +38,10 @@ struct structure_graph_builder
     return m_graph.extent();
   }
 
+  // N.B. If the graph was frozen, it is unfrozen first, since the vertices may be modified.
   std::vector<structure_graph::vertex>& vertices()
   {
+    m_graph.unfreeze();
     return m_graph.m_vertices;
   }
 
@@ -50,6 +52,7 @@ struct structure_graph_builder
 
   structure_graph::vertex& vertex(index_type u)
   {
+    m_graph.unfreeze();
     return m_graph.m_vertices[u];
   }
 
@@ -276,6 +279,7 @@ struct manual_structure_graph_builder
   /// \details May be called more than once. Does not invalidate this builder.
   void finalize()
   {
+    m_graph.unfreeze();
     m_graph.m_vertices = m_vertices;
     m_graph.m_initial_vertex = m_initial_state;
 
@@ -20,7 +20,9 @@
 #include "mcrl2/pbes/is_bes.h"
 #include "mcrl2/pbes/lps2pbes.h"
 #include "mcrl2/pbes/pbesinst_algorithm.h"
+#include "mcrl2/pbes/pbesinst_alternative_lazy_algorithm.h"
 #include "mcrl2/pbes/pbesinst_finite_algorithm.h"
+#include "mcrl2/pbes/pbesinst_lazy.h"
 #include "mcrl2/pbes/pbesinst_symbolic.h"
 #include "mcrl2/pbes/rewriter.h"
 #include "mcrl2/pbes/txt2pbes.h"
@@ -263,6 +265,66 @@ BOOST_AUTO_TEST_CASE(test_abp_no_deadlock)
   BOOST_CHECK(is_bes(q));
 }
 
+// Collects the equations that are reported by the lazy instantiation algorithm.
+class pbesinst_lazy_equations: public pbesinst_lazy_algorithm
+{
+  public:
+    std::set<std::string> equations;
+
+    pbesinst_lazy_equations(const pbessolve_options& options, const pbes& p)
+      : pbesinst_lazy_algorithm(options, p)
+    {}
+
+    void on_report_equation(const propositional_variable_instantiation& X, const pbes_expression& psi, std::size_t k) override
+    {
+      equations.insert(pbes_system::pp(X) + " = " + pbes_system::pp(psi) + " " + std::to_string(k));
+    }
+};
+
+std::set<std::string> pbesinst_lazy_equations_of(const pbes& p, bool compile_equations)
+{
+  pbessolve_options options;
+  options.compile_equations = compile_equations;
+  pbesinst_lazy_equations algorithm(options, p);
+  algorithm.run();
+  return algorithm.equations;
+}
+
+std::set<std::string> pbesinst_alternative_lazy_equations_of(const pbes& p, transformation_strategy strategy, bool compile_equations)
+{
+  pbes q = p;
+  data::rewriter datar(q.data());
+  pbesinst_alternative_lazy_algorithm algorithm(q.data(), datar, breadth_first, strategy, bes::none, atermpp::npos, true, compile_equations);
+  algorithm.run(q);
+  pbes result_pbes = algorithm.get_result(false);
+  std::set<std::string> result;
+  for (const pbes_equation& eqn: result_pbes.equations())
+  {
+    result.insert(pbes_system::pp(eqn));
+  }
+  return result;
+}
+
+// Checks that instantiation with compiled equations yields the same equations.
+void test_compile_equations(const pbes& p)
+{
+  BOOST_CHECK(pbesinst_lazy_equations_of(p, false) == pbesinst_lazy_equations_of(p, true));
+  BOOST_CHECK(pbesinst_alternative_lazy_equations_of(p, lazy, false) == pbesinst_alternative_lazy_equations_of(p, lazy, true));
+  BOOST_CHECK(pbesinst_alternative_lazy_equations_of(p, on_the_fly, false) == pbesinst_alternative_lazy_equations_of(p, on_the_fly, true));
+}
+
+BOOST_AUTO_TEST_CASE(test_pbesinst_compile_equations)
+{
+  for (const std::string& text: { test2, test4, test5, test6, test7, test8, random3 })
+  {
+    test_compile_equations(txt2pbes(text));
+  }
+
+  lps::specification spec=remove_stochastic_operators(lps::linearise(lps::detail::ABP_SPECIFICATION()));
+  state_formulas::state_formula formula = state_formulas::parse_state_formula(lps::detail::NO_DEADLOCK(), spec);
+  test_compile_equations(lps2pbes(spec, formula, false));
+}
+
 // Example supplied by Tim Willemse, 23-05-2011
 BOOST_AUTO_TEST_CASE(test_functions)
 {
@@ -0,0 +1,129 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file structure_graph_test.cpp
+/// \brief Tests for freezing and solving structure graphs.
+
+#define BOOST_TEST_MODULE structure_graph_test
+#include <random>
+#include <boost/test/included/unit_test_framework.hpp>
+#include "mcrl2/pbes/solve_structure_graph.h"
+#include "mcrl2/pbes/structure_graph_builder.h"
+
+using namespace mcrl2;
+using namespace mcrl2::pbes_system;
+
+std::vector<structure_graph::index_type> to_vector(const structure_graph::index_range& r)
+{
+  return std::vector<structure_graph::index_type>(r.begin(), r.end());
+}
+
+// Builds a structure graph with vertices 0, ..., 3 and edges 0->1, 0->2, 1->1, 2->3 and 3->2.
+// The only way for the disjunctive player to avoid the odd rank of 1 is to move to 2.
+void build_graph(structure_graph& G)
+{
+  detail::manual_structure_graph_builder builder(G);
+  auto v0 = builder.insert_vertex(false, 0);
+  auto v1 = builder.insert_vertex(false, 1);
+  auto v2 = builder.insert_vertex(true, 0);
+  auto v3 = builder.insert_vertex(false, 2);
+  builder.insert_edge(v0, v1);
+  builder.insert_edge(v0, v2);
+  builder.insert_edge(v1, v1);
+  builder.insert_edge(v2, v3);
+  builder.insert_edge(v3, v2);
+  builder.set_initial_state(v0);
+  builder.finalize();
+}
+
+BOOST_AUTO_TEST_CASE(test_freeze)
+{
+  structure_graph G;
+  build_graph(G);
+
+  std::vector<std::vector<structure_graph::index_type>> successors;
+  std::vector<std::vector<structure_graph::index_type>> predecessors;
+  for (structure_graph::index_type u = 0; u < G.extent(); u++)
+  {
+    successors.push_back(to_vector(G.all_successors(u)));
+    predecessors.push_back(to_vector(G.all_predecessors(u)));
+  }
+
+  G.freeze();
+  BOOST_CHECK(G.is_frozen());
+  BOOST_CHECK(G.is_defined());
+  for (structure_graph::index_type u = 0; u < G.extent(); u++)
+  {
+    BOOST_CHECK(G.find_vertex(u).successors.empty());
+    BOOST_CHECK(to_vector(G.all_successors(u)) == successors[u]);
+    BOOST_CHECK(to_vector(G.all_predecessors(u)) == predecessors[u]);
+  }
+
+  G.exclude()[1] = true;
+  BOOST_CHECK(structure_graph_successors(G, 0) == std::vector<structure_graph::index_type>({ 2 }));
+  G.exclude()[1] = false;
+
+  G.unfreeze();
+  BOOST_CHECK(!G.is_frozen());
+  for (structure_graph::index_type u = 0; u < G.extent(); u++)
+  {
+    BOOST_CHECK(G.find_vertex(u).successors == successors[u]);
+    BOOST_CHECK(G.find_vertex(u).predecessors == predecessors[u]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_solve_frozen)
+{
+  structure_graph G;
+  build_graph(G);
+  BOOST_CHECK(solve_structure_graph(G, true));
+  BOOST_CHECK(G.is_frozen());
+  BOOST_CHECK_EQUAL(G.strategy(0), 2u);
+}
+
+// Builds a random structure graph with n vertices, in which every vertex has at least one successor.
+void build_random_graph(structure_graph& G, std::size_t n, std::size_t max_rank, std::mt19937& generator)
+{
+  detail::manual_structure_graph_builder builder(G);
+  std::uniform_int_distribution<std::size_t> vertex(0, n - 1);
+  std::uniform_int_distribution<std::size_t> rank(0, max_rank);
+  std::uniform_int_distribution<std::size_t> outdegree(1, 3);
+  for (std::size_t i = 0; i < n; i++)
+  {
+    builder.insert_vertex(generator() % 2 == 0, rank(generator));
+  }
+  for (std::size_t i = 0; i < n; i++)
+  {
+    std::size_t k = outdegree(generator);
+    for (std::size_t j = 0; j < k; j++)
+    {
+      builder.insert_edge(i, vertex(generator));
+    }
+  }
+  builder.set_initial_state(0);
+  builder.finalize();
+}
+
+BOOST_AUTO_TEST_CASE(test_solve_parallel)
+{
+  std::mt19937 generator(12345);
+  for (std::size_t i = 0; i < 5; i++)
+  {
+    structure_graph G;
+    build_random_graph(G, 20000, 5, generator);
+    structure_graph G2 = G;
+    structure_graph G4 = G;
+    bool result = solve_structure_graph(G);
+    BOOST_CHECK_EQUAL(solve_structure_graph(G2, true, 2), result);
+    BOOST_CHECK_EQUAL(solve_structure_graph(G4, true, 4), result);
+    for (structure_graph::index_type u = 0; u < G.extent(); u++)
+    {
+      BOOST_CHECK_EQUAL(G2.strategy(u), G4.strategy(u));
+    }
+  }
+}
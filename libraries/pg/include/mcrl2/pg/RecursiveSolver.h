@@ -11,6 +11,7 @@
 #define MCRL2_PG_RECURSIVE_SOLVER_H
 
 #include "mcrl2/utilities/logger.h"
+#include "mcrl2/pg/DenseSet.h"
 #include "mcrl2/pg/ParityGameSolver.h"
 
 /*! Provides a view of a strategy corresponding to a subset of the vertex set.
@@ -97,11 +98,12 @@ private:
 int first_inversion(const ParityGame &game);
 
 
-/*! Parity game solver implementing Zielonka's recursive algorithm. */
+/*! Parity game solver implementing Zielonka's recursive algorithm. If more
+    than one thread is used, the attractor sets are computed in parallel. */
 class RecursiveSolver : public ParityGameSolver
 {
 public:
-    RecursiveSolver(const ParityGame &game);
+    RecursiveSolver(const ParityGame &game, std::size_t number_of_threads = 1);
     ~RecursiveSolver();
 
     ParityGame::Strategy solve();
@@ -109,14 +111,28 @@ public:
 private:
     /*! Solves a subgame recursively, or returns false if solving is aborted. */
     bool solve(ParityGame &game, Substrategy &strat);
+
+    /*! Extends `vertices` to its attractor set for `player`. */
+    void make_attractor(const ParityGame &game, ParityGame::Player player,
+                        DenseSet<verti> &vertices, Substrategy &strat);
+
+    //! The number of threads used to compute attractor sets.
+    std::size_t number_of_threads_;
 };
 
 //! Factory object for RecursiveSolver instances.
 class RecursiveSolverFactory : public ParityGameSolverFactory
 {
+public:
+    RecursiveSolverFactory(std::size_t number_of_threads = 1)
+        : number_of_threads_(number_of_threads) { }
+
     //! Returns a new ResuriveSolver instance.
     ParityGameSolver *create( const ParityGame &game,
         const verti *vertex_map, verti vertex_map_size );
+
+private:
+    std::size_t number_of_threads_;
 };
 
 #endif /* ndef MCRL2_PG_RECURSIVE_SOLVER_H */
@@ -32,6 +32,17 @@ template<class SetT, class DequeT, class StrategyT>
 void make_attractor_set( const ParityGame &game, ParityGame::Player player,
     SetT &vertices, DequeT &todo, StrategyT &strategy );
 
+/*! Computes the same attractor set as make_attractor_set(), using
+    `number_of_threads` threads. The vertices are added in rounds; in each
+    round the predecessors of the vertices added in the previous round are
+    examined in parallel. The strategy of a vertex controlled by `player` is
+    its least successor that was added in the previous round, so the result
+    does not depend on the number of threads. The game graph must store
+    predecessor edges. */
+template<class SetT, class StrategyT>
+void make_attractor_set_parallel( const ParityGame &game, ParityGame::Player player,
+    SetT &vertices, StrategyT &strategy, std::size_t number_of_threads );
+
 #include "attractor_impl.h"
 
 #endif /* MCRL2_PG_ATTRACTOR_H */
@@ -14,7 +14,11 @@
 #include "mcrl2/pg/Graph.h"
 #include "mcrl2/pg/ParityGame_impl.h"
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
 #include <queue>
+#include "mcrl2/utilities/parallel_for.h"
 
 template<class ForwardIterator, class SetT>
 bool is_subset_of(ForwardIterator it, ForwardIterator end, const SetT &set)
@@ -145,4 +149,105 @@ void make_attractor_set_2( const ParityGame &game, ParityGame::Player player,
     }
 }
 
+template<class SetT, class StrategyT>
+void make_attractor_set_parallel( const ParityGame &game, ParityGame::Player player,
+    SetT &vertices, StrategyT &strategy, std::size_t number_of_threads )
+{
+    const StaticGraph &graph = game.graph();
+    const verti V = graph.V();
+
+    // liberties[v] is the number of successors of v that are not in the
+    // attractor set, or 0 if v has been added. choice[v] is the least
+    // successor through which a player-controlled vertex v was attracted.
+    std::unique_ptr<std::atomic<verti>[]> liberties(new std::atomic<verti>[V]);
+    std::unique_ptr<std::atomic<verti>[]> choice(new std::atomic<verti>[V]);
+    std::vector<std::vector<verti> > added(number_of_threads);
+
+    mcrl2::utilities::parallel_for_blocks(V, number_of_threads,
+        [&](std::size_t, std::size_t begin, std::size_t end)
+        {
+            for (std::size_t v = begin; v < end; ++v)
+            {
+                liberties[v].store(0, std::memory_order_relaxed);
+                choice[v].store(NO_VERTEX, std::memory_order_relaxed);
+            }
+        });
+    mcrl2::utilities::parallel_for_blocks(V, number_of_threads,
+        [&](std::size_t, std::size_t begin, std::size_t end)
+        {
+            for (std::size_t w = begin; w < end; ++w)
+            {
+                for (StaticGraph::const_iterator it = graph.pred_begin(w);
+                     it != graph.pred_end(w); ++it)
+                {
+                    liberties[*it].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    for (typename SetT::const_iterator it = vertices.begin();
+         it != vertices.end(); ++it)
+    {
+        liberties[*it].store(0, std::memory_order_relaxed);
+    }
+
+    // Small rounds are handled by fewer threads, to limit the overhead of starting threads.
+    const std::size_t minimal_block_size = 256;
+
+    std::vector<verti> frontier(vertices.begin(), vertices.end());
+    while (!frontier.empty())
+    {
+        mcrl2::utilities::parallel_for_blocks(frontier.size(),
+            std::min(number_of_threads, 1 + frontier.size() / minimal_block_size),
+            [&](std::size_t t, std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    const verti w = frontier[i];
+
+                    // Check all predecessors v of w:
+                    for (StaticGraph::const_iterator it = graph.pred_begin(w);
+                         it != graph.pred_end(w); ++it)
+                    {
+                        const verti v = *it;
+
+                        // Skip predecessors that were in the attractor set
+                        // before this round:
+                        if (vertices.count(v)) continue;
+
+                        if (game.player(v) == player)
+                        {
+                            if (liberties[v].exchange(0) != 0)
+                            {
+                                added[t].push_back(v);
+                            }
+                            verti current = choice[v].load();
+                            while (w < current &&
+                                   !choice[v].compare_exchange_weak(current, w)) { }
+                        }
+                        else
+                        if (liberties[v].fetch_sub(1) == 1)
+                        {
+                            added[t].push_back(v);
+                        }
+                    }
+                }
+            });
+
+        frontier.clear();
+        for (std::size_t t = 0; t < added.size(); ++t)
+        {
+            frontier.insert(frontier.end(), added[t].begin(), added[t].end());
+            added[t].clear();
+        }
+        std::sort(frontier.begin(), frontier.end());
+        for (std::vector<verti>::const_iterator it = frontier.begin();
+             it != frontier.end(); ++it)
+        {
+            const verti v = *it;
+            strategy[v] = game.player(v) == player ? choice[v].load() : NO_VERTEX;
+            vertices.insert(v);
+        }
+    }
+}
+
 #endif // MCRL2_PG_ATTRACTOR_IMPL_H
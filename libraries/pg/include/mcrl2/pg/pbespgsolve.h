@@ -23,6 +23,7 @@
 #include "mcrl2/pg/RecursiveSolver.h"
 #include "mcrl2/pg/SmallProgressMeasures.h"
 #include "mcrl2/utilities/execution_timer.h"
+#include "mcrl2/utilities/parallel_for.h"
 
 namespace mcrl2 {
 
@@ -33,6 +34,7 @@ enum pbespg_solver_type
   spm_solver,
   alternative_spm_solver,
   recursive_solver,
+  parallel_recursive_solver,
   priority_promotion
 };
 
@@ -51,6 +53,10 @@ pbespg_solver_type parse_solver_type(const std::string& s)
   {
     return recursive_solver;
   }
+  else if (s == "parrecursive")
+  {
+    return parallel_recursive_solver;
+  }
   else if (s == "prioprom")
   {
     return priority_promotion;
@@ -67,6 +73,7 @@ std::string print(const pbespg_solver_type solver_type)
     case spm_solver: return "spm";
     case alternative_spm_solver: return "altspm";
     case recursive_solver: return "recursive";
+    case parallel_recursive_solver: return "parrecursive";
     case priority_promotion: return "prioprom";
   }
   throw mcrl2::runtime_error("unknown solver");
@@ -81,6 +88,7 @@ std::string description(const pbespg_solver_type solver_type)
     case spm_solver: return "Small progress measures";
     case alternative_spm_solver: return "Alternative implementation of small progress measures";
     case recursive_solver: return "Recursive algorithm";
+    case parallel_recursive_solver: return "Recursive algorithm with attractor sets computed by multiple threads";
     case priority_promotion: return "Priority promotion (experimental)";
   }
   throw mcrl2::runtime_error("unknown solver");
@@ -138,6 +146,7 @@ struct pbespgsolve_options
   bool verify_solution;
   bool only_generate;
   data::rewriter::strategy rewrite_strategy;
+  std::size_t number_of_threads; // only used by the parallel recursive solver
 
   pbespgsolve_options()
     : solver_type(spm_solver),
@@ -146,7 +155,8 @@ struct pbespgsolve_options
       use_deloop_solver(true),
       verify_solution(true),
       only_generate(false),
-      rewrite_strategy(data::jitty)
+      rewrite_strategy(data::jitty),
+      number_of_threads(utilities::hardware_threads())
   {
   }
 };
@@ -179,6 +189,11 @@ class pbespgsolve_algorithm
         // Create a recursive solver factory:
         solver_factory.reset(new RecursiveSolverFactory);
       }
+      else if (options.solver_type == parallel_recursive_solver)
+      {
+        // Create a recursive solver factory that computes attractor sets in parallel:
+        solver_factory.reset(new RecursiveSolverFactory(options.number_of_threads));
+      }
       else if (options.solver_type == priority_promotion)
       {
         solver_factory.reset(new PriorityPromotionSolverFactory);
@@ -55,8 +55,8 @@ int first_inversion(const ParityGame &game)
     return p < d ? p : d;
 }
 
-RecursiveSolver::RecursiveSolver(const ParityGame &game)
-    : ParityGameSolver(game)
+RecursiveSolver::RecursiveSolver(const ParityGame &game, std::size_t number_of_threads)
+    : ParityGameSolver(game), number_of_threads_(number_of_threads)
 {
 }
 
@@ -86,6 +86,19 @@ ParityGame::Strategy RecursiveSolver::solve()
    iterators to produce the set contents in-order.
 */
 
+void RecursiveSolver::make_attractor( const ParityGame &game,
+    ParityGame::Player player, DenseSet<verti> &vertices, Substrategy &strat )
+{
+    if (number_of_threads_ > 1)
+    {
+        make_attractor_set_parallel(game, player, vertices, strat, number_of_threads_);
+    }
+    else
+    {
+        make_attractor_set_2(game, player, vertices, strat);
+    }
+}
+
 bool RecursiveSolver::solve(ParityGame &game, Substrategy &strat)
 {
     if (aborted()) return false;
@@ -110,7 +123,7 @@ bool RecursiveSolver::solve(ParityGame &game, Substrategy &strat)
             }
             mCRL2log(mcrl2::log::debug) <<"|min_prio|=" << min_prio_attr.size() << std::endl;
             assert(!min_prio_attr.empty());
-            make_attractor_set_2(game, player, min_prio_attr, strat);
+            make_attractor(game, player, min_prio_attr, strat);
             mCRL2log(mcrl2::log::debug) << "|min_prio_attr|=" << min_prio_attr.size() << std::endl;
             if (min_prio_attr.size() == V) break;
             get_complement(V, min_prio_attr).swap(unsolved);
@@ -138,7 +151,7 @@ bool RecursiveSolver::solve(ParityGame &game, Substrategy &strat)
             }
             mCRL2log(mcrl2::log::debug) << "|lost|=" << lost_attr.size() << std::endl;
             if (lost_attr.empty()) break;
-            make_attractor_set_2(game, opponent, lost_attr, strat);
+            make_attractor(game, opponent, lost_attr, strat);
             mCRL2log(mcrl2::log::debug) << "|lost_attr|=" << lost_attr.size() << std::endl;
             get_complement(V, lost_attr).swap(unsolved);
         }
@@ -212,5 +225,5 @@ ParityGameSolver *RecursiveSolverFactory::create( const ParityGame &game,
     (void)vertex_map;       // unused
     (void)vertex_map_size;  // unused
 
-    return new RecursiveSolver(game);
+    return new RecursiveSolver(game, number_of_threads_);
 }
@@ -47,6 +47,16 @@ public:
   /// \details Uses most significant bit encoding.
   void write_integer(std::size_t value);
 
+  /// \brief Writes zero bits up to the next multiple of 64 bits, such that the bits that are written next
+  ///        start at byte position() of the stream.
+  void align();
+
+  /// \returns The number of bytes that have been written to the output stream by this bitstream.
+  std::size_t position() const
+  {
+    return bytes_written;
+  }
+
 private:
   /// \brief Flush the remaining bits in the buffer to the output stream.
   /// \details Note that this aligns it to the next byte, e.g. when bits_in_buffer is 6 then two zero bits are added redundantly.
@@ -62,6 +72,8 @@ private:
 
   unsigned int bits_in_buffer = 0; ///< how many bits in are used in the buffer.
 
+  std::size_t bytes_written = 0; ///< how many bytes have been written to the stream.
+
   std::uint8_t integer_buffer[integer_encoding_size<std::size_t>()]; ///< Reserved space to store an n byte integer.
 };
 
@@ -84,6 +96,13 @@ public:
   /// \returns A natural number that was read from the binary stream encoded in most significant bit encoding.
   std::size_t read_integer();
 
+  /// \brief Skips the bits that were written by the corresponding call to obitstream::align().
+  void align();
+
+  /// \brief Discards the buffered bits. Must be called after the position of the input stream has been changed
+  ///        to a position that was aligned when it was written.
+  void reset();
+
 private:
   /// \brief Read size bytes into the provided buffer.
   void read(std::size_t size, std::uint8_t* buffer);
@@ -95,6 +114,8 @@ private:
 
   unsigned int bits_in_buffer = 0; ///< how many bits in the buffer are used.
 
+  std::size_t bits_read = 0; ///< how many bits have been read since the last aligned position.
+
   std::vector<char> m_text_buffer; ///< A temporary buffer to store char array strings.
 };
 
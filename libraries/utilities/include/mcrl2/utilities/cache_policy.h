@@ -10,7 +10,10 @@
 #ifndef MCRL2_UTILITIES_CACHE_POLICY_H
 #define MCRL2_UTILITIES_CACHE_POLICY_H
 
+#include <cstddef>
 #include <forward_list>
+#include <unordered_map>
+#include <vector>
 
 #include <assert.h>
 
@@ -123,6 +126,81 @@ private:
   typename std::forward_list<key_type>::iterator m_last_element_it;
 };
 
+/// \brief The clock (or second chance) policy. The keys are kept in a circular buffer together with a
+///        reference bit that is set whenever the key is found in the cache. The clock hand skips over,
+///        and clears, referenced keys; the first unreferenced key is replaced.
+template<typename Map>
+class clock_policy final : public replacement_policy<Map>
+{
+public:
+  using key_type = typename Map::key_type;
+
+  void clear() override
+  {
+    m_keys.clear();
+    m_referenced.clear();
+    m_position.clear();
+    m_hand = 0;
+    m_free = false;
+  }
+
+  typename Map::iterator replacement_candidate(Map& map) override
+  {
+    assert(!m_keys.empty() && !m_free);
+    while (m_referenced[m_hand])
+    {
+      m_referenced[m_hand] = false;
+      advance_hand();
+    }
+
+    // The slot of the replaced key is reused by the next key that is inserted.
+    auto it = map.find(m_keys[m_hand]);
+    m_position.erase(m_keys[m_hand]);
+    m_free = true;
+    assert(it != map.end());
+    return it;
+  }
+
+  void inserted(const key_type& key) override
+  {
+    if (m_free)
+    {
+      m_keys[m_hand] = key;
+      m_referenced[m_hand] = false;
+      m_position[key] = m_hand;
+      m_free = false;
+      advance_hand();
+    }
+    else
+    {
+      m_position[key] = m_keys.size();
+      m_keys.push_back(key);
+      m_referenced.push_back(false);
+    }
+  }
+
+  void touch(const key_type& key) override
+  {
+    auto it = m_position.find(key);
+    if (it != m_position.end())
+    {
+      m_referenced[it->second] = true;
+    }
+  }
+
+private:
+  void advance_hand()
+  {
+    m_hand = (m_hand + 1 == m_keys.size() ? 0 : m_hand + 1);
+  }
+
+  std::vector<key_type> m_keys;
+  std::vector<bool> m_referenced;
+  std::unordered_map<key_type, std::size_t> m_position; ///< The slot of each key in m_keys.
+  std::size_t m_hand = 0;
+  bool m_free = false; ///< Whether the key at the clock hand has been replaced and its slot is free.
+};
+
 } // namespace utilities
 } // namespace mcrl2
 
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <cassert>
 #include <deque>
@@ -37,16 +38,39 @@ static const float max_load_factor = 0.75f; ///< The load factor before the hash
 
 static const size_t minimal_hashtable_size = 8;  ///< With a max_load of 0.75 the minimal size of the hashtable must be 8.
 
-static const std::size_t PRIME_NUMBER = 999953;
+/// The hash of a key is multiplied by this number, which is 2^64 divided by the golden ratio, and the most
+/// significant bits of the product are used as position in the hashtable. This spreads hashes whose lower bits
+/// are poorly distributed, such as the addresses of terms.
+static const std::uint64_t FIBONACCI_NUMBER = 11400714819323198485ull;
+
+/// \returns The number of bits that the product of a hash and FIBONACCI_NUMBER is shifted to obtain a position
+///          in a hashtable of the given size, which must be a power of two.
+inline std::size_t hashtable_shift(std::size_t size)
+{
+  assert(is_power_of_two(size));
+  std::size_t shift = 64;
+  for (; size > 1; size >>= 1)
+  {
+    --shift;
+  }
+  return shift;
+}
 
 } // namespace detail
 
+template <class Key, typename Hash, typename Equals, typename Allocator>
+inline
+std::size_t indexed_set<Key,Hash,Equals,Allocator>::start_position(const key_type& key) const
+{
+  return static_cast<std::size_t>((static_cast<std::uint64_t>(m_hasher(key)) * detail::FIBONACCI_NUMBER) >> m_shift);
+}
+
 template <class Key, typename Hash, typename Equals, typename Allocator>
 inline
 std::size_t indexed_set<Key,Hash,Equals,Allocator>::put_in_hashtable(const key_type& key, std::size_t value)
 {
   // Find a place to insert key and find whether key already exists.
-  std::size_t start = (m_hasher(key) * detail::PRIME_NUMBER) % m_hashtable.size();
+  std::size_t start = start_position(key);
   std::size_t position = start;
 
   while (true)
@@ -66,7 +90,7 @@ std::size_t indexed_set<Key,Hash,Equals,Allocator>::put_in_hashtable(const key_t
       // key is already in the set, return position of key.
       return index;
     }
-    position = (position + detail::STEP) % m_hashtable.size();
+    position = (position + detail::STEP) & (m_hashtable.size() - 1);
 
     assert(position != start); // In this case the hashtable is full, which should never happen.
   }
@@ -79,6 +103,7 @@ template <class Key, typename Hash, typename Equals, typename Allocator>
 inline void indexed_set<Key, Hash, Equals, Allocator>::resize_hashtable()
 {
   m_hashtable = std::vector<std::size_t>(m_hashtable.size() * 2, detail::EMPTY);
+  m_shift = detail::hashtable_shift(m_hashtable.size());
 
   size_t index = 0;
   for (const Key& k : m_keys)
@@ -98,7 +123,8 @@ template <class Key, typename Hash, typename Equals, typename Allocator>
 inline indexed_set<Key,Hash,Equals,Allocator>::indexed_set(std::size_t initial_size,
   const hasher& hasher,
   const key_equal& equals)
-      : m_hashtable(std::max(initial_size, detail::minimal_hashtable_size), detail::EMPTY),
+      : m_hashtable(round_up_to_power_of_two(std::max(initial_size, detail::minimal_hashtable_size)), detail::EMPTY),
+        m_shift(detail::hashtable_shift(m_hashtable.size())),
         m_hasher(hasher),
         m_equals(equals)
 {}
@@ -106,7 +132,7 @@ inline indexed_set<Key,Hash,Equals,Allocator>::indexed_set(std::size_t initial_s
 template <class Key, typename Hash, typename Equals, typename Allocator>
 inline typename indexed_set<Key,Hash,Equals,Allocator>::size_type indexed_set<Key,Hash,Equals,Allocator>::index(const key_type& key) const
 {
-  std::size_t start = (m_hasher(key) * detail::PRIME_NUMBER) % m_hashtable.size();
+  std::size_t start = start_position(key);
   std::size_t position = start;
 
   do
@@ -122,7 +148,7 @@ inline typename indexed_set<Key,Hash,Equals,Allocator>::size_type indexed_set<Ke
       return index;
     }
 
-    position = (position + detail::STEP) % m_hashtable.size();
+    position = (position + detail::STEP) & (m_hashtable.size() - 1);
     assert(position!=start); // The hashtable is full. This should never happen.
   }
   while (true);
@@ -133,10 +159,10 @@ inline typename indexed_set<Key,Hash,Equals,Allocator>::size_type indexed_set<Ke
 template <class Key, typename Hash, typename Equals, typename Allocator>
 inline typename indexed_set<Key,Hash,Equals,Allocator>::const_iterator indexed_set<Key,Hash,Equals,Allocator>::find(const key_type& key) const
 {
-  const std::size_t index = index(key);
-  if (index < m_keys.size())
+  const std::size_t i = index(key);
+  if (i < m_keys.size())
   {
-    return m_keys[index];
+    return m_keys.begin() + i;
   }
 
   return end();
@@ -30,6 +30,7 @@ class fixed_size_cache
 {
 public:
   using key_type = typename Policy::key_type;
+  using mapped_type = typename Policy::map_type::mapped_type;
   using iterator = typename Policy::map_type::iterator;
   using const_iterator = typename Policy::map_type::const_iterator;
 
@@ -48,6 +49,9 @@ public:
     }
   }
 
+  iterator begin() { return m_map.begin(); }
+  iterator end() { return m_map.end(); }
+
   const_iterator begin() const { return m_map.begin(); }
   const_iterator end() const { return m_map.end(); }
 
@@ -55,20 +59,29 @@ public:
 
   std::size_t count(const key_type& key) const { return m_map.count(key); }
 
+  /// \brief Returns an iterator to the element with the given key, or end() if there is none. The policy
+  ///        is informed when the element is found.
   iterator find(const key_type& key)
   {
-    return m_map.find(key);
+    auto result = m_map.find(key);
+    if (result != m_map.end())
+    {
+      m_policy.touch(key);
+    }
+    return result;
   }
 
+  std::size_t size() const { return m_map.size(); }
+
   /// \brief Stores the given key-value pair in the cache. Depending on the cache policy and capacity an existing element
   ///        might be removed.
   template<typename ...Args>
-  std::pair<iterator, bool> emplace(Args&&... args)
+  std::pair<iterator, bool> emplace(const key_type& key, Args&&... args)
   {
     // The reason to split the find and emplace is that when we insert an element the replacement_candidate should not be
     // the key that we just inserted. The other way around, when an element that we are looking for was first removed and
     // then searched for also leads to unnecessary inserts.
-    auto result = find(args...);
+    auto result = m_map.find(key);
     if (result == m_map.end())
     {
       // If the cache would be full after an inserted.
@@ -79,7 +92,7 @@ public:
       }
 
       // Insert an element and inform the policy that an element was inserted.
-      auto emplace_result = m_map.emplace(std::forward<Args>(args)...);
+      auto emplace_result = m_map.emplace(std::make_pair(key, mapped_type(std::forward<Args>(args)...)));
       m_policy.inserted((*emplace_result.first).first);
       return emplace_result;
     }
@@ -151,6 +164,9 @@ private:
 template<typename Key, typename T>
 using fifo_cache = fixed_size_cache<fifo_policy<mcrl2::utilities::unordered_map<Key, T>>>;
 
+template<typename Key, typename T>
+using clock_cache = fixed_size_cache<clock_policy<mcrl2::utilities::unordered_map<Key, T>>>;
+
 template<typename F, typename Args>
 using fifo_function_cache = function_cache<
   fifo_policy<mcrl2::utilities::unordered_map<Args, decltype(std::declval<F>()(std::declval<Args>()))>>,
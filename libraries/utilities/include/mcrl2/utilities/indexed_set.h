@@ -11,6 +11,7 @@
 
 #include <deque>
 
+#include "mcrl2/utilities/power_of_two.h"
 #include "mcrl2/utilities/unordered_map.h"
 #include "mcrl2/utilities/block_allocator.h"
 
@@ -20,6 +21,8 @@ namespace utilities
 {
 
 /// \brief A set that assigns each element an unique index.
+/// \details The indices are stored in an open addressing hash table, and the keys in a deque in the order of
+///          their index. Therefore, an element takes the space of its key and approximately two indices.
 template<typename Key,
          typename Hash = std::hash<Key>,
          typename Equals = std::equal_to<Key>,
@@ -30,9 +33,15 @@ private:
   std::vector<std::size_t> m_hashtable;
   std::deque<Key, Allocator> m_keys;
 
+  /// \brief The number of bits of a hash that are discarded to obtain a position in the hashtable.
+  std::size_t m_shift;
+
   Hash m_hasher;
   Equals m_equals;
 
+  /// \brief Returns the position in the hashtable at which the search for the given key starts.
+  inline std::size_t start_position(const Key& key) const;
+
   /// \brief Inserts the given (key, n) pair into the indexed set.
   std::size_t put_in_hashtable(const Key& key, std::size_t n);
 
@@ -51,11 +60,11 @@ public:
   typedef value_type* pointer;
   typedef const value_type* const_pointer;
 
-  typedef typename std::deque < Key >::iterator iterator;
-  typedef typename std::deque < Key >::const_iterator const_iterator;
+  typedef typename std::deque < Key, Allocator >::iterator iterator;
+  typedef typename std::deque < Key, Allocator >::const_iterator const_iterator;
 
-  typedef typename std::deque < Key >::reverse_iterator reverse_iterator;
-  typedef typename std::deque < Key >::const_reverse_iterator const_reverse_iterator;
+  typedef typename std::deque < Key, Allocator >::reverse_iterator reverse_iterator;
+  typedef typename std::deque < Key, Allocator >::const_reverse_iterator const_reverse_iterator;
 
   typedef std::ptrdiff_t difference_type;
   
@@ -66,7 +75,7 @@ public:
   /// \brief Constructor of an empty indexed set. Starts with a hashtable of size 128.
   indexed_set();
 
-  /// \brief Constructor of an empty index set. Starts with a hashtable of the indicated size. 
+  /// \brief Constructor of an empty index set. Starts with a hashtable of the indicated size, rounded up to a power of two.
   /// \param initial_hashtable_size The initial size of the hashtable.
   indexed_set(std::size_t initial_hashtable_size,
     const hasher& hash = hasher(),
@@ -102,13 +111,13 @@ public:
 
   /// \brief Forward iterator which runs through the elements from the lowest to the largest number.
   /// \details Complexity is constant per operation.
-  iterator begin() const
+  const_iterator begin() const
   {
     return m_keys.begin();
   }
 
   /// \brief End of the forward iterator.
-  iterator end() const
+  const_iterator end() const
   {
     return m_keys.end();
   }
@@ -126,25 +135,25 @@ public:
   }
 
   /// \brief Reverse iterator going through the elements in the set from the largest to the smallest index. 
-  iterator rbegin() 
+  reverse_iterator rbegin() 
   { 
     return m_keys.rbegin(); 
   }
 
   /// \brief End of the reverse iterator. 
-  iterator rend()
+  reverse_iterator rend()
   { 
     return m_keys.rend(); 
   }
 
   /// \brief Reverse const_iterator going through the elements from the highest to the lowest numbered element. 
-  const_iterator crbegin() const
+  const_reverse_iterator crbegin() const
   { 
     return m_keys.crbegin(); 
   }
 
   /// \brief End of the reverse const_iterator. 
-  const_iterator crend() const 
+  const_reverse_iterator crend() const 
   { 
     return m_keys.crend(); 
   }
@@ -164,6 +173,12 @@ public:
   /// \return An iterator to the key, otherwise end().
   const_iterator find(const key_type& key) const;
 
+  /// \brief Indicates whether the key is in the indexed set.
+  bool contains(const key_type& key) const
+  {
+    return index(key) != npos;
+  }
+
   /// \brief The number of elements in the indexed set.
   /// \return The number of elements in the indexed set. 
   size_type size() const
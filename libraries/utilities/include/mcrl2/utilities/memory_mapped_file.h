@@ -0,0 +1,73 @@
+// Author(s): Jan Friso Groote
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/utilities/memory_mapped_file.h
+/// \brief Read-only access to the contents of a file as one contiguous sequence of characters.
+
+#ifndef MCRL2_UTILITIES_MEMORY_MAPPED_FILE_H
+#define MCRL2_UTILITIES_MEMORY_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "mcrl2/utilities/noncopyable.h"
+
+namespace mcrl2
+{
+namespace utilities
+{
+
+/// \brief Provides the contents of a file, or of standard input, as a contiguous sequence of characters.
+/// \details Regular files are mapped into memory where the platform supports it, such that they are not
+///          copied and are read by the operating system on demand. Otherwise, the contents are read into
+///          a buffer. The contents are not terminated by a zero character.
+class memory_mapped_file: private noncopyable
+{
+public:
+  /// \brief Opens the file and provides access to its contents.
+  /// \param filename The name of the file, or the empty string for standard input.
+  /// \exception mcrl2::runtime_error The file cannot be opened or read.
+  explicit memory_mapped_file(const std::string& filename);
+  ~memory_mapped_file();
+
+  /// \returns A pointer to the first character of the contents.
+  const char* begin() const
+  {
+    return m_data;
+  }
+
+  /// \returns A pointer past the last character of the contents.
+  const char* end() const
+  {
+    return m_data + m_size;
+  }
+
+  /// \returns The number of characters of the contents.
+  std::size_t size() const
+  {
+    return m_size;
+  }
+
+  /// \returns True if the contents are mapped into memory instead of copied to a buffer.
+  bool is_mapped() const
+  {
+    return m_mapped;
+  }
+
+private:
+  const char* m_data = nullptr;
+  std::size_t m_size = 0;
+  bool m_mapped = false;
+  std::vector<char> m_buffer; ///< The contents if they are not mapped.
+};
+
+} // namespace utilities
+} // namespace mcrl2
+
+#endif // MCRL2_UTILITIES_MEMORY_MAPPED_FILE_H
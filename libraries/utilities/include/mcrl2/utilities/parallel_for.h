@@ -0,0 +1,62 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/utilities/parallel_for.h
+/// \brief Splits a range of indices over a number of threads.
+
+#ifndef MCRL2_UTILITIES_PARALLEL_FOR_H
+#define MCRL2_UTILITIES_PARALLEL_FOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace mcrl2 {
+
+namespace utilities {
+
+/// \brief Returns the number of threads that can run concurrently on this machine, which is at least one.
+inline
+std::size_t hardware_threads()
+{
+  return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+/// \brief Splits [0, n) into at most number_of_threads consecutive blocks of (almost) equal size, and
+/// calls f(t, begin, end) for the t-th block [begin, end) in a separate thread.
+/// \details The calling thread handles the first block, and the function returns once all blocks have
+/// been handled. The function f should not throw, and should not create terms unless the toolset is
+/// built with multi-threading enabled.
+template <typename Function>
+void parallel_for_blocks(std::size_t n, std::size_t number_of_threads, Function f)
+{
+  if (n == 0)
+  {
+    return;
+  }
+  number_of_threads = std::max<std::size_t>(1, std::min(number_of_threads, n));
+  std::size_t block_size = (n + number_of_threads - 1) / number_of_threads;
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 1; t * block_size < n; t++)
+  {
+    threads.emplace_back(f, t, t * block_size, std::min(n, (t + 1) * block_size));
+  }
+  f(0, 0, std::min(n, block_size));
+  for (std::thread& thread: threads)
+  {
+    thread.join();
+  }
+}
+
+} // namespace utilities
+
+} // namespace mcrl2
+
+#endif // MCRL2_UTILITIES_PARALLEL_FOR_H
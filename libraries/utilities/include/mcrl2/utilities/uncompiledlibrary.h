@@ -26,21 +26,40 @@
  *
  * Remarks:
  *
- * The source is compiled using a script that must take two string arguments.
- * The first argument is the source file, the second is the destination file.
- * After (successful) termination, only the source and destination files must
- * remain on disk -- it is the responsibility of the script to remove any
- * temporary files.
+ * The source is compiled using a script that takes the source files as its
+ * arguments, and prints the names of the files it created, the last one
+ * being the library. Additional compiler flags can be passed to the script
+ * in the environment variable MCRL2_COMPILEFLAGS.
+ *
+ * Compiled libraries can be stored in a cache directory, under a key that is
+ * provided by the caller. The key must determine the source completely. A
+ * library is stored under a hash of the key and the compile script, and the
+ * key itself is stored next to it to rule out hash collisions. Files in the
+ * cache are written to a temporary file and renamed, so that processes that
+ * populate the cache concurrently never observe a partially written library.
+ *
+ *   uncompiled_library mylib;
+ *   if (!mylib.load_from_cache(cache_directory, key))
+ *   {
+ *     mylib.compile({ source_filename }, cache_directory, key);
+ *   }
  *
  */
 
 #include <cassert>
 #include <cerrno>
+#include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
 #include <list>
 #include <string>
 #include <sstream>
 #include <stdexcept>
+#include <vector>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "mcrl2/utilities/dynamiclibrary.h"
 #include "mcrl2/utilities/file_utility.h"
 #include "mcrl2/utilities/logger.h"
@@ -51,13 +70,116 @@ class uncompiled_library : public dynamic_library
     std::list<std::string> m_tempfiles;
     std::string m_compile_script;
 
+    // Returns the contents of the given file, or an empty string if it cannot be read.
+    static std::string read_file(const std::string& filename)
+    {
+      std::ifstream in(filename, std::ios::binary);
+      std::stringstream result;
+      result << in.rdbuf();
+      return result.str();
+    }
+
+    // Writes text to filename by writing a temporary file first and renaming it, such that
+    // other processes observe either no file or a complete one.
+    static bool write_file_atomically(const std::string& filename, const std::string& text)
+    {
+      std::string tempname = filename + "." + std::to_string(getpid()) + ".tmp";
+      {
+        std::ofstream out(tempname, std::ios::binary);
+        out << text;
+        if (!out)
+        {
+          remove(tempname.c_str());
+          return false;
+        }
+      }
+      if (rename(tempname.c_str(), filename.c_str()) != 0)
+      {
+        remove(tempname.c_str());
+        return false;
+      }
+      return true;
+    }
+
+    // Creates the directory dir, including missing parent directories. Returns true if
+    // the directory exists afterwards.
+    static bool create_directories(const std::string& dir)
+    {
+      for (std::size_t i = 1; i <= dir.size(); ++i)
+      {
+        if (i == dir.size() || dir[i] == '/')
+        {
+          std::string prefix = dir.substr(0, i);
+          if (mkdir(prefix.c_str(), 0755) != 0 && errno != EEXIST)
+          {
+            return false;
+          }
+        }
+      }
+      struct stat info;
+      return stat(dir.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+    }
+
+    // The 64 bit FNV-1a hash of text.
+    static std::uint64_t hash(const std::string& text)
+    {
+      std::uint64_t result = 14695981039346656037ull;
+      for (unsigned char c: text)
+      {
+        result = (result ^ c) * 1099511628211ull;
+      }
+      return result;
+    }
+
+    // Returns the value of the given environment variable, or the empty string if it is not set.
+    static std::string environment_variable(const char* name)
+    {
+      const char* value = std::getenv(name);
+      return value == nullptr ? std::string() : std::string(value);
+    }
+
+    // The text that identifies the library with the given key in a cache. Besides the key, it
+    // contains the compile script, and the compiler and the flags that it uses.
+    std::string cache_entry(const std::string& key) const
+    {
+      return m_compile_script + "\n" + read_file(m_compile_script) + "\n" + environment_variable("CXX") + "\n" 
+             + environment_variable("MCRL2_COMPILEFLAGS") + "\n" + key;
+    }
+
+    // The name of the files in cache_directory for the given cache entry, without extension.
+    static std::string cache_filename(const std::string& cache_directory, const std::string& entry)
+    {
+      std::stringstream filename;
+      filename << cache_directory << (*cache_directory.rbegin() == '/' ? "" : "/")
+               << std::hex << std::setw(16) << std::setfill('0') << hash(entry);
+      return filename.str();
+    }
+
   public:
     uncompiled_library(const std::string& script) : m_compile_script(script) {}
 
     void compile(const std::string& filename) 
+    {
+      compile(std::vector<std::string>{ filename });
+    }
+
+    /// \brief Compiles the given source files into one library.
+    /// \param filenames The source files.
+    /// \param flags Compiler flags that are passed to the compile script in addition to the value
+    ///        of the environment variable MCRL2_COMPILEFLAGS.
+    void compile(const std::vector<std::string>& filenames, const std::string& flags = std::string())
     {
       std::stringstream commandline;
-      commandline << '"' << m_compile_script << "\" " << filename << " " << " 2>&1";
+      if (!flags.empty())
+      {
+        commandline << "MCRL2_COMPILEFLAGS=\"$MCRL2_COMPILEFLAGS " << flags << "\" ";
+      }
+      commandline << '"' << m_compile_script << '"';
+      for (const std::string& filename: filenames)
+      {
+        commandline << " " << filename;
+      }
+      commandline << " 2>&1";
       
       // Execute script.
       FILE* stream = popen(commandline.str().c_str(), "r");
@@ -117,6 +239,46 @@ class uncompiled_library : public dynamic_library
       m_filename = m_tempfiles.back();
     }
 
+    /// \brief Uses the library that was stored in cache_directory under the given key, if it exists.
+    /// \return Whether the library was found.
+    bool load_from_cache(const std::string& cache_directory, const std::string& key)
+    {
+      const std::string entry = cache_entry(key);
+      const std::string filename = cache_filename(cache_directory, entry);
+      if (mcrl2::utilities::file_exists(filename + ".so") && read_file(filename + ".key") == entry)
+      {
+        m_filename = filename + ".so";
+        return true;
+      }
+      return false;
+    }
+
+    /// \brief Compiles the given source files into one library, and stores it in cache_directory
+    ///        under the given key. If cache_directory is empty, the library is not stored. Problems
+    ///        with the cache are reported, but do not prevent compilation.
+    void compile(const std::vector<std::string>& filenames, const std::string& cache_directory, const std::string& key)
+    {
+      compile(filenames);
+      if (cache_directory.empty())
+      {
+        return;
+      }
+
+      // The key is stored before the library, such that a library in the cache always has its key.
+      const std::string entry = cache_entry(key);
+      const std::string cache_file = cache_filename(cache_directory, entry);
+      if (!create_directories(cache_directory) ||
+          !write_file_atomically(cache_file + ".key", entry) ||
+          !write_file_atomically(cache_file + ".so", read_file(m_filename)))
+      {
+        mCRL2log(mcrl2::log::warning) << "Could not store the compiled library in the cache directory " << cache_directory << "." << std::endl;
+      }
+      else
+      {
+        mCRL2log(mcrl2::log::verbose) << "stored the compiled library as " << cache_file << ".so" << std::endl;
+      }
+    }
+
     void leave_files()
     {
       m_tempfiles.clear();
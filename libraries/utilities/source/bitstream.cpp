@@ -131,6 +131,7 @@ void obitstream::write_bits(std::size_t value, unsigned int number_of_bits)
       // Write the 8 * i most significant bits and mask out the other values.
       stream.put(static_cast<char>((write_value >> (8 * i)) & 255));
     }
+    bytes_written += 8;
   }
 }
 
@@ -206,6 +207,7 @@ std::size_t ibitstream::read_bits(unsigned int number_of_bits)
   // Shift the first bit to the first position in the buffer.
   read_buffer <<= number_of_bits;
   bits_in_buffer -= number_of_bits;
+  bits_read += number_of_bits;
 
   return value;
 }
@@ -215,13 +217,34 @@ std::size_t ibitstream::read_integer()
   return decode_variablesize_int(*this);
 }
 
+void obitstream::align()
+{
+  if (bits_in_buffer > 0)
+  {
+    write_bits(0, 64 - bits_in_buffer);
+  }
+  assert(bits_in_buffer == 0);
+}
+
+void ibitstream::align()
+{
+  read_bits(static_cast<unsigned int>((64 - bits_read % 64) % 64));
+  assert(bits_read % 64 == 0);
+}
+
+void ibitstream::reset()
+{
+  read_buffer = 0;
+  bits_in_buffer = 0;
+  bits_read = 0;
+}
+
 // Private functions
 
 void obitstream::flush()
 {
   // Writing the buffer full to 64 bits should flush it internally, this also guarantees that the unnecessary bits are zeroed out.
-  write_bits(0, 64 - bits_in_buffer);
-  assert(bits_in_buffer == 0);
+  align();
 
   if (stream.fail())
   {
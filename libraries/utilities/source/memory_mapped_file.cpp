@@ -0,0 +1,98 @@
+// Author(s): Jan Friso Groote
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "mcrl2/utilities/memory_mapped_file.h"
+
+#include "mcrl2/utilities/exception.h"
+#include "mcrl2/utilities/platform.h"
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#ifndef MCRL2_PLATFORM_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // MCRL2_PLATFORM_WINDOWS
+
+namespace mcrl2
+{
+namespace utilities
+{
+
+/// \brief Reads the remaining characters of the stream into the buffer.
+static void read_into_buffer(std::istream& is, std::vector<char>& buffer)
+{
+  buffer.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+}
+
+memory_mapped_file::memory_mapped_file(const std::string& filename)
+{
+  if (filename.empty())
+  {
+    read_into_buffer(std::cin, m_buffer);
+  }
+  else
+  {
+#ifndef MCRL2_PLATFORM_WINDOWS
+    int descriptor = open(filename.c_str(), O_RDONLY);
+    if (descriptor < 0)
+    {
+      throw mcrl2::runtime_error("Cannot open file " + filename + " for reading.");
+    }
+
+    struct stat status;
+    if (fstat(descriptor, &status) == 0 && S_ISREG(status.st_mode) && status.st_size > 0)
+    {
+      void* address = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+      if (address != MAP_FAILED)
+      {
+        // The contents are typically read once from the start to the end.
+        madvise(address, static_cast<std::size_t>(status.st_size), MADV_SEQUENTIAL);
+        m_data = static_cast<const char*>(address);
+        m_size = static_cast<std::size_t>(status.st_size);
+        m_mapped = true;
+      }
+    }
+    close(descriptor);
+#endif // MCRL2_PLATFORM_WINDOWS
+
+    if (!m_mapped)
+    {
+      // Fall back to reading the file, e.g. for pipes or platforms without mmap.
+      std::ifstream is(filename, std::ifstream::in | std::ifstream::binary);
+      if (!is.is_open())
+      {
+        throw mcrl2::runtime_error("Cannot open file " + filename + " for reading.");
+      }
+      read_into_buffer(is, m_buffer);
+    }
+  }
+
+  if (!m_mapped)
+  {
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+  }
+}
+
+memory_mapped_file::~memory_mapped_file()
+{
+#ifndef MCRL2_PLATFORM_WINDOWS
+  if (m_mapped)
+  {
+    munmap(const_cast<char*>(m_data), m_size);
+  }
+#endif // MCRL2_PLATFORM_WINDOWS
+}
+
+} // namespace utilities
+} // namespace mcrl2
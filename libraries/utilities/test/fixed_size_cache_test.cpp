@@ -38,3 +38,17 @@ BOOST_AUTO_TEST_CASE(test_function_cache)
   }
 
 }
+
+BOOST_AUTO_TEST_CASE(test_clock_cache)
+{
+  clock_cache<int, int> cache(16);
+  for (int i = 0; i < 100; ++i)
+  {
+    cache.emplace(i, i * i);
+
+    // Element 0 is found over and over again, so the clock policy never removes it.
+    BOOST_CHECK(cache.find(0) != cache.end());
+    BOOST_CHECK_EQUAL(cache.count(i), 1u);
+  }
+  BOOST_CHECK(cache.find(1) == cache.end());
+}
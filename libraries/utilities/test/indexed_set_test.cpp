@@ -54,3 +54,35 @@ BOOST_AUTO_TEST_CASE(basic_test_indexed_set)
   x[2] = t;
 }
 
+
+BOOST_AUTO_TEST_CASE(resize_test_indexed_set)
+{
+  indexed_set<std::size_t> t(10);
+  for (std::size_t i = 0; i < 10000; ++i)
+  {
+    std::pair<std::size_t, bool> p = t.insert(i * 16);
+    BOOST_CHECK(p.first == i);
+    BOOST_CHECK(p.second);
+  }
+  BOOST_CHECK(t.size() == 10000);
+
+  for (std::size_t i = 0; i < 10000; ++i)
+  {
+    std::pair<std::size_t, bool> p = t.insert(i * 16);
+    BOOST_CHECK(p.first == i);
+    BOOST_CHECK(!p.second);
+    BOOST_CHECK(t.contains(i * 16));
+    BOOST_CHECK(*t.find(i * 16) == i * 16);
+  }
+  BOOST_CHECK(!t.contains(1));
+  BOOST_CHECK(t.index(1) == indexed_set<std::size_t>::npos);
+  BOOST_CHECK(t.find(1) == t.end());
+
+  const indexed_set<std::size_t>& t1 = t;
+  std::size_t index = 0;
+  for (std::size_t key: t1)
+  {
+    BOOST_CHECK(key == index * 16);
+    ++index;
+  }
+}
@@ -39,6 +39,8 @@ class generatelts_tool: public rewriter_tool<input_output_tool>
   lps::explorer_options options;
   lts::lts_type output_format = lts::lts_none;
   lps::explorer* current_explorer = nullptr;
+  bool write_index = false;
+  std::size_t block_size = 0;
 
   public:
     generatelts_tool()
@@ -116,7 +118,44 @@ class generatelts_tool: public rewriter_tool<input_output_tool>
                             "horrendous. This feature helps to suppress those. Other verbose messages, "
                             "such as the total number of states explored, just remain visible. ");
       desc.add_option("no-store", "save the resulting LTS to disk while generating. Currently this only works "
-                              "for .aut files.");
+                              "for .aut and .lts files.");
+      desc.add_option("index", "write an index of the outgoing transitions of every state to OUTFILE.idx, such that "
+                              "the successors of a state can be looked up without loading the LTS. This only works "
+                              "in combination with the option --no-store for .lts files.");
+      desc.add_option("block-size", utilities::make_mandatory_argument("NUM"),
+                              "write the .lts file in blocks that share at most NUM subterms, such that the memory "
+                              "needed for writing and reading it does not grow with its size. This only works in "
+                              "combination with the option --no-store for .lts files.");
+      desc.add_option("tree-compression", "store the discovered states using tree compression, i.e. every value of a "
+                              "process parameter is stored once, and a state is stored as a tree of indices of these values. "
+                              "This reduces the memory usage for models with many process parameters. ");
+      desc.add_option("partial-order-reduction", "explore only the enabled summands of a stubborn set in every state. "
+                 "The stubborn sets are computed from the process parameters that summands read and write. This "
+                 "preserves all deadlocks, and the traces of the actions in the option --visible and the option --action. "
+                 "It cannot be combined with the option --confluence, and is ignored for timed exploration. ");
+      desc.add_option("visible", utilities::make_mandatory_argument("NAMES"),
+                 "preserve the traces of the actions in NAMES, a comma-separated list, when the option "
+                 "--partial-order-reduction is set. ");
+      desc.add_option("incremental-guards", "do not evaluate the condition of a summand in a state if it was false in "
+                 "the predecessor of the state, and the transition between them did not change any of the process "
+                 "parameters in the condition. This is only used for untimed exploration with one thread and without "
+                 "partial order reduction. ");
+      desc.add_option("bit-hash", utilities::make_optional_argument("NUM", "200000000"),
+                 "store the discovered states in a table of NUM bits (default 2*10^8, i.e. 25MB) using bit state "
+                 "hashing. Every state sets the bits of a number of hash values, and a state is considered to be "
+                 "new if one of its bits was not yet set. Hence states may be missed, but very large state spaces "
+                 "can be explored for deadlocks and actions. An estimate of the probability that states were "
+                 "missed is printed at the end. This only works for .aut output or no output at all. ");
+      desc.add_option("hash-functions", utilities::make_mandatory_argument("NUM"),
+                 "use NUM hash functions for the option --bit-hash (default 3). ");
+      desc.add_option("hash-compaction", "store a 64-bit fingerprint of every discovered state instead of the state "
+                 "itself. States with the same fingerprint are considered to be equal, hence states may be missed. "
+                 "An estimate of the probability that states were missed is printed at the end. This only works for "
+                 ".aut output or no output at all. ");
+      desc.add_option("threads", utilities::make_mandatory_argument("NUM"),
+                 "use NUM threads to compute the outgoing transitions of states. This is only supported for "
+                 "untimed breadth-first exploration, and requires a toolset that is built with multi-threading "
+                 "enabled. The numbering of states and transitions is the same as for a single thread. ");
     }
 
     std::list<std::string> split_actions(const std::string& s)
@@ -166,6 +205,12 @@ class generatelts_tool: public rewriter_tool<input_output_tool>
       options.detect_divergence                     = parser.has_option("divergence");
       options.save_error_trace                      = parser.has_option("error-trace");
       options.suppress_progress_messages            = parser.has_option("suppress");
+      options.tree_compression                      = parser.has_option("tree-compression");
+      options.partial_order_reduction               = parser.has_option("partial-order-reduction");
+      options.incremental_guard_evaluation          = parser.has_option("incremental-guards");
+      options.bit_hashing                           = parser.has_option("bit-hash");
+      options.hash_compaction                       = parser.has_option("hash-compaction");
+      write_index                                   = parser.has_option("index");
       options.search_strategy = parser.option_argument_as<lps::exploration_strategy>("strategy");
 
       if (parser.has_option("max"))
@@ -178,6 +223,42 @@ class generatelts_tool: public rewriter_tool<input_output_tool>
         options.todo_max = parser.option_argument_as<std::size_t>("todo-max");
       }
 
+      if (parser.has_option("threads"))
+      {
+        options.number_of_threads = parser.option_argument_as<std::size_t>("threads");
+        if (options.number_of_threads == 0)
+        {
+          parser.error("The number of threads must be at least one.");
+        }
+      }
+
+      if (options.bit_hashing)
+      {
+        options.bit_hash_size = parser.option_argument_as<std::size_t>("bit-hash");
+        if (options.bit_hash_size == 0)
+        {
+          parser.error("The number of bits of the option --bit-hash must be at least one.");
+        }
+      }
+
+      if (parser.has_option("hash-functions"))
+      {
+        if (!options.bit_hashing)
+        {
+          parser.error("Option --hash-functions requires the option --bit-hash.");
+        }
+        options.number_of_hash_functions = parser.option_argument_as<std::size_t>("hash-functions");
+        if (options.number_of_hash_functions == 0)
+        {
+          parser.error("The number of hash functions must be at least one.");
+        }
+      }
+
+      if (options.bit_hashing + options.hash_compaction + options.tree_compression > 1)
+      {
+        parser.error("At most one of the options --bit-hash, --hash-compaction and --tree-compression can be set.");
+      }
+
       if (parser.has_option("out"))
       {
         output_format = lts::detail::parse_format(parser.option_argument("out"));
@@ -235,17 +316,62 @@ class generatelts_tool: public rewriter_tool<input_output_tool>
         options.priority_action = parser.option_argument("confluence");
       }
 
+      if (parser.has_option("visible"))
+      {
+        if (!options.partial_order_reduction)
+        {
+          parser.error("Option --visible requires the option --partial-order-reduction.");
+        }
+        for (const std::string& s: split_actions(parser.option_argument("visible")))
+        {
+          options.visible_actions.insert(core::identifier_string(s));
+        }
+      }
+      if (options.partial_order_reduction)
+      {
+        if (options.confluence)
+        {
+          parser.error("Option --partial-order-reduction cannot be combined with the option --confluence.");
+        }
+        options.visible_actions.insert(options.trace_actions.begin(), options.trace_actions.end());
+      }
+
       if (2 < parser.arguments.size())
       {
         parser.error("Too many file arguments.");
       }
 
-      if (options.no_store && (output_filename().empty() || output_format != lts::lts_aut))
+      if (options.no_store && (output_filename().empty() || (output_format != lts::lts_aut && output_format != lts::lts_lts)))
       {
         options.no_store = false;
         mCRL2log(log::warning) << "Ignoring the no-store option.";
       }
 
+      if ((options.bit_hashing || options.hash_compaction) && output_format != lts::lts_aut && output_format != lts::lts_none)
+      {
+        parser.error("The options --bit-hash and --hash-compaction only work for .aut output or no output at all.");
+      }
+
+      if (parser.has_option("block-size"))
+      {
+        block_size = parser.option_argument_as<std::size_t>("block-size");
+        if (block_size == 0)
+        {
+          parser.error("The block size must be positive.");
+        }
+        if (!options.no_store || output_format != lts::lts_lts)
+        {
+          block_size = 0;
+          mCRL2log(log::warning) << "Ignoring the block-size option.";
+        }
+      }
+
+      if (write_index && (!options.no_store || output_format != lts::lts_lts))
+      {
+        write_index = false;
+        mCRL2log(log::warning) << "Ignoring the index option.";
+      }
+
       if (options.search_strategy == lps::es_highway && !parser.has_option("todo-max"))
       {
         parser.error("Search strategy 'highway' requires that the option todo-max is set");
@@ -264,7 +390,11 @@ class generatelts_tool: public rewriter_tool<input_output_tool>
           }
         case lts::lts_dot: return std::unique_ptr<lts::lts_builder>(new lts::lts_dot_builder(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters()));
         case lts::lts_fsm: return std::unique_ptr<lts::lts_builder>(new lts::lts_fsm_builder(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters()));
-        case lts::lts_lts: return std::unique_ptr<lts::lts_builder>(new lts::lts_lts_builder(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters()));
+        case lts::lts_lts:
+          {
+            return options.no_store ? std::unique_ptr<lts::lts_builder>(new lts::lts_lts_disk_builder(output_filename(), lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), write_index ? output_filename() + ".idx" : std::string(), block_size))
+                                    : std::unique_ptr<lts::lts_builder>(new lts::lts_lts_builder(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters()));
+          }
         default: return std::unique_ptr<lts::lts_builder>(new lts::lts_none_builder());
       }
     }
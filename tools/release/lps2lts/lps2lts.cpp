@@ -84,8 +84,15 @@ class lps2lts_tool : public lps2lts_base
                    "\n"
                    "If the 'jittyc' rewriter is used, then the MCRL2_COMPILEREWRITER environment "
                    "variable (default value: 'mcrl2compilerewriter') determines the script that "
-                   "compiles the rewriter, and MCRL2_COMPILEDIR (default value: '.') determines "
-                   "where temporary files are stored.\n"
+                   "compiles the rewriter, MCRL2_COMPILEDIR (default value: '.') determines "
+                   "where temporary files are stored, and MCRL2_COMPILECACHE (default value: "
+                   "'$XDG_CACHE_HOME/mcrl2/jittyc') determines where compiled rewriters are "
+                   "cached. If MCRL2_COMPILECACHE is empty, compiled rewriters are not cached. "
+                   "The generated code is split over MCRL2_COMPILEJOBS (default value: the number "
+                   "of hardware threads) files that are compiled in parallel, with the additional "
+                   "compiler flags in MCRL2_COMPILEFLAGS. If MCRL2_COMPILEQUICKFLAGS is set, the "
+                   "rewriter is first compiled with these flags, and replaced by a rewriter that is "
+                   "compiled in the background with the default flags when that is ready.\n"
                    "\n"
                    "Note that lps2lts can deliver multiple transitions with the same label between"
                    "any pair of states. If this is not desired, such transitions can be removed by"
@@ -97,8 +104,16 @@ class lps2lts_tool : public lps2lts_base
                    +mcrl2::lts::detail::supported_lts_formats_text()+"\n"
                    "If the jittyc rewriter is used, then the MCRL2_COMPILEREWRITER environment "
                    "variable (default value: mcrl2compilerewriter) determines the script that "
-                   "compiles the rewriter, and MCRL2_COMPILEDIR (default value: '.') "
-                   "determines where temporary files are stored."
+                   "compiles the rewriter, MCRL2_COMPILEDIR (default value: '.') "
+                   "determines where temporary files are stored, and MCRL2_COMPILECACHE "
+                   "(default value: '$XDG_CACHE_HOME/mcrl2/jittyc') determines where "
+                   "compiled rewriters are cached. If MCRL2_COMPILECACHE is empty, "
+                   "compiled rewriters are not cached. The generated code is split over "
+                   "MCRL2_COMPILEJOBS (default value: the number of hardware threads) files "
+                   "that are compiled in parallel, with the additional compiler flags in "
+                   "MCRL2_COMPILEFLAGS. If MCRL2_COMPILEQUICKFLAGS is set, the rewriter is "
+                   "first compiled with these flags, and replaced by a rewriter that is "
+                   "compiled in the background with the default flags when that is ready."
                    "\n"
                    "Note that lps2lts can deliver multiple transitions with the same "
                    "label between any pair of states. If this is not desired, such "
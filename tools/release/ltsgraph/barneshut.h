@@ -0,0 +1,232 @@
+// Author(s): Rimco Boudewijns and Sjoerd Cranen
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+/**
+
+  @file barneshut.h
+
+  This file contains a spatial tree that approximates the repulsive forces between all pairs of a set of
+  points in O(n log n) time, using the Barnes-Hut algorithm.
+
+*/
+
+#ifndef MCRL2_LTSGRAPH_BARNESHUT_H
+#define MCRL2_LTSGRAPH_BARNESHUT_H
+
+#include <QVector3D>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace Graph
+{
+
+/**
+ * @brief A Barnes-Hut tree of a set of points. In 3D every cell is split into eight children (an octree), and
+ *        in 2D, i.e. when the z-coordinate is ignored, every cell is split into four children (a quadtree).
+ *        The force on a point is approximated by treating every cell that is small compared to its distance
+ *        to the point as a single body at the center of mass of the cell.
+ */
+class BarnesHutTree
+{
+  private:
+    struct Cell
+    {
+      QVector3D center;           ///< The center of the bounding box of the cell.
+      float halfSize;             ///< Half of the width of the bounding box of the cell.
+      QVector3D massCenter;       ///< The sum of the positions of the points in the cell, and after
+                                  ///< construction their average.
+      QVector3D point;            ///< The position of the first point that was inserted in a leaf.
+      float mass = 0.0f;          ///< The number of points in the cell.
+      std::size_t firstChild = 0; ///< The index of the first child, or 0 if the cell is a leaf.
+
+      Cell(const QVector3D& center_, float halfSize_)
+        : center(center_), halfSize(halfSize_)
+      {}
+    };
+
+    /// The maximum depth of the tree. Points that end up in the same cell at this depth are treated as one body.
+    static constexpr std::size_t MaximumDepth = 32;
+
+    std::vector<Cell> m_cells;          ///< The cells of the tree, the root is the first cell.
+    bool m_planar = false;              ///< Indicates that the z-coordinate is ignored.
+
+    std::size_t childCount() const
+    {
+      return m_planar ? 4 : 8;
+    }
+
+    /// @brief Returns the offset of the child of cell that contains pos.
+    std::size_t childOffset(const Cell& cell, const QVector3D& pos) const
+    {
+      std::size_t result = 0;
+      if (pos.x() >= cell.center.x())
+      {
+        result |= 1;
+      }
+      if (pos.y() >= cell.center.y())
+      {
+        result |= 2;
+      }
+      if (!m_planar && pos.z() >= cell.center.z())
+      {
+        result |= 4;
+      }
+      return result;
+    }
+
+    /// @brief Creates the children of the cell with the given index.
+    void split(std::size_t index)
+    {
+      float quarter = m_cells[index].halfSize / 2.0f;
+      QVector3D center = m_cells[index].center;
+      m_cells[index].firstChild = m_cells.size();
+      for (std::size_t i = 0; i < childCount(); ++i)
+      {
+        QVector3D offset((i & 1) ? quarter : -quarter, (i & 2) ? quarter : -quarter, m_planar ? 0.0f : ((i & 4) ? quarter : -quarter));
+        m_cells.emplace_back(center + offset, quarter);
+      }
+    }
+
+    void insert(const QVector3D& pos)
+    {
+      std::size_t index = 0;
+      for (std::size_t depth = 0; ; ++depth)
+      {
+        Cell& cell = m_cells[index];
+        if (cell.firstChild != 0)
+        {
+          cell.mass += 1.0f;
+          cell.massCenter += pos;
+          index = cell.firstChild + childOffset(cell, pos);
+          continue;
+        }
+
+        // An empty leaf, or a leaf with points at the same position as pos, or a leaf at the maximum depth.
+        if (cell.mass == 0.0f || cell.point == pos || depth == MaximumDepth)
+        {
+          if (cell.mass == 0.0f)
+          {
+            cell.point = pos;
+          }
+          cell.mass += 1.0f;
+          cell.massCenter += pos;
+          return;
+        }
+
+        // A leaf with points at another position, which are moved to a new child.
+        QVector3D other = cell.point;
+        split(index);
+        Cell& parent = m_cells[index];
+        Cell& child = m_cells[parent.firstChild + childOffset(parent, other)];
+        child.mass = parent.mass;
+        child.massCenter = parent.massCenter;
+        child.point = other;
+      }
+    }
+
+  public:
+    /**
+     * @brief Builds the tree for the given points.
+     * @param points The positions of the points.
+     * @param planar If true, the z-coordinates of the points are ignored and a quadtree is built.
+     */
+    void build(const std::vector<QVector3D>& points, bool planar)
+    {
+      m_planar = planar;
+      m_cells.clear();
+      m_cells.reserve(2 * points.size() + 1);
+      if (points.empty())
+      {
+        return;
+      }
+
+      QVector3D minimum = points.front();
+      QVector3D maximum = points.front();
+      for (const QVector3D& pos : points)
+      {
+        minimum = QVector3D((std::min)(minimum.x(), pos.x()), (std::min)(minimum.y(), pos.y()), (std::min)(minimum.z(), pos.z()));
+        maximum = QVector3D((std::max)(maximum.x(), pos.x()), (std::max)(maximum.y(), pos.y()), (std::max)(maximum.z(), pos.z()));
+      }
+      QVector3D extent = maximum - minimum;
+      float size = (std::max)({extent.x(), extent.y(), planar ? 0.0f : extent.z(), 1.0f});
+      m_cells.emplace_back((minimum + maximum) / 2.0f, size / 2.0f + 1.0f);
+
+      for (const QVector3D& pos : points)
+      {
+        insert(pos);
+      }
+      for (Cell& cell : m_cells)
+      {
+        if (cell.mass > 0.0f)
+        {
+          cell.massCenter /= cell.mass;
+        }
+      }
+    }
+
+    /**
+     * @brief Computes the total force on a point of the tree that is exerted by the other points.
+     * @param pos The position of the point, which must be one of the points of the tree.
+     * @param pairForce A function pairForce(a, b, mass) that returns the force on a exerted by mass points at b.
+     * @param theta The accuracy of the approximation. A cell is treated as a single body if its width divided by
+     *        its distance to pos is less than theta. If theta is zero, the exact force is computed.
+     * This function does not modify the tree, hence it can be called by several threads at the same time.
+     */
+    template <typename Force>
+    QVector3D force(const QVector3D& pos, Force pairForce, float theta) const
+    {
+      QVector3D result(0, 0, 0);
+      if (m_cells.empty())
+      {
+        return result;
+      }
+
+      // Every level of the tree adds at most eight cells to the stack, of which one is removed first.
+      std::array<std::size_t, 8 * (MaximumDepth + 1)> stack;
+      std::size_t size = 0;
+      stack[size++] = 0;
+      while (size > 0)
+      {
+        const Cell& cell = m_cells[stack[--size]];
+        if (cell.mass == 0.0f)
+        {
+          continue;
+        }
+
+        if (cell.firstChild == 0)
+        {
+          // The point itself is not taken into account.
+          float mass = cell.point == pos ? cell.mass - 1.0f : cell.mass;
+          if (mass > 0.0f)
+          {
+            result += pairForce(pos, cell.massCenter, mass);
+          }
+        }
+        else if (2.0f * cell.halfSize < theta * (pos - cell.massCenter).length())
+        {
+          result += pairForce(pos, cell.massCenter, cell.mass);
+        }
+        else
+        {
+          for (std::size_t i = 0; i < childCount(); ++i)
+          {
+            stack[size++] = cell.firstChild + i;
+          }
+        }
+      }
+      return result;
+    }
+};
+
+} // namespace Graph
+
+#endif // MCRL2_LTSGRAPH_BARNESHUT_H
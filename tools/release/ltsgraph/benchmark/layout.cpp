@@ -0,0 +1,135 @@
+// Author(s): Rimco Boudewijns and Sjoerd Cranen
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// This benchmark measures the time of the force computations of the spring layout of ltsgraph, without a user
+// interface. It lays out the .aut files that are given as arguments, or randomly generated graphs of increasing
+// size if there are no arguments.
+
+#include "barneshut.h"
+
+#include "mcrl2/lts/lts_aut.h"
+#include "mcrl2/utilities/stopwatch.h"
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <utility>
+
+using namespace Graph;
+
+struct layout_graph
+{
+  std::vector<QVector3D> positions;
+  std::vector<std::pair<std::size_t, std::size_t>> edges;
+};
+
+static layout_graph random_graph(std::size_t number_of_nodes, std::size_t out_degree, std::mt19937& generator)
+{
+  std::uniform_int_distribution<std::size_t> node(0, number_of_nodes - 1);
+  layout_graph result;
+  for (std::size_t i = 0; i < number_of_nodes * out_degree; ++i)
+  {
+    result.edges.emplace_back(i / out_degree, node(generator));
+  }
+  result.positions.resize(number_of_nodes);
+  return result;
+}
+
+static layout_graph load_graph(const std::string& filename)
+{
+  mcrl2::lts::lts_aut_t lts;
+  lts.load(filename);
+  layout_graph result;
+  for (const mcrl2::lts::transition& t : lts.get_transitions())
+  {
+    result.edges.emplace_back(t.from(), t.to());
+  }
+  result.positions.resize(lts.num_states());
+  return result;
+}
+
+// Performs the given number of iterations of the layout, with the default parameters of ltsgraph.
+static void layout(layout_graph& graph, std::size_t iterations, float theta, std::mt19937& generator)
+{
+  const float speed = 0.001f;
+  const float attraction = 0.13f;
+  const float natLength = 50.0f;
+  const float repulsion = 50.0f * natLength * natLength * natLength;
+
+  std::uniform_real_distribution<float> coordinate(-1000.0f, 1000.0f);
+  for (QVector3D& pos : graph.positions)
+  {
+    pos = QVector3D(coordinate(generator), coordinate(generator), coordinate(generator));
+  }
+
+  auto pairForce = [repulsion, natLength](const QVector3D& a, const QVector3D& b, float mass)
+  {
+    QVector3D diff = a - b;
+    float r = repulsion * mass;
+    r /= std::pow((std::max)(diff.length() / 2.0f, natLength / 10), 3);
+    return diff * r;
+  };
+
+  BarnesHutTree tree;
+  std::vector<QVector3D> forces(graph.positions.size());
+  stopwatch timer;
+  for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+  {
+    tree.build(graph.positions, false);
+    for (std::size_t i = 0; i < graph.positions.size(); ++i)
+    {
+      forces[i] = tree.force(graph.positions[i], pairForce, theta);
+    }
+
+    for (const auto& edge : graph.edges)
+    {
+      QVector3D diff = graph.positions[edge.second] - graph.positions[edge.first];
+      float dist = (std::max)(diff.length(), 1.0f);
+      QVector3D f = diff * (attraction * 10000 * std::log(dist / (natLength + 1.0f)) / dist);
+      forces[edge.first] += f;
+      forces[edge.second] -= f;
+    }
+
+    for (std::size_t i = 0; i < graph.positions.size(); ++i)
+    {
+      graph.positions[i] += speed * forces[i];
+    }
+  }
+
+  std::cerr << "Laying out " << graph.positions.size() << " nodes and " << graph.edges.size() << " edges with theta "
+            << theta << " took " << timer.time() / static_cast<double>(iterations) << " milliseconds per iteration.\n";
+}
+
+int main(int argc, char* argv[])
+{
+  const std::size_t iterations = 10;
+  std::mt19937 generator(42);
+
+  if (argc > 1)
+  {
+    for (int i = 1; i < argc; ++i)
+    {
+      layout_graph graph = load_graph(argv[i]);
+      layout(graph, iterations, 1.0f, generator);
+    }
+    return 0;
+  }
+
+  for (std::size_t number_of_nodes : { 1000, 5000, 10000, 50000 })
+  {
+    layout_graph graph = random_graph(number_of_nodes, 3, generator);
+    // A theta of zero computes the exact forces, which takes quadratic time.
+    if (number_of_nodes <= 5000)
+    {
+      layout(graph, iterations, 0.0f, generator);
+    }
+    layout(graph, iterations, 1.0f, generator);
+  }
+  return 0;
+}
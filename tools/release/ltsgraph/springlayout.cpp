@@ -16,6 +16,7 @@
 #include <cmath>
 #include <cstdlib>
 #include <ctime>
+#include <thread>
 
 namespace Graph
 {
@@ -53,7 +54,7 @@ inline void clip(float& f, float min, float max)
 //
 
 SpringLayout::SpringLayout(Graph& graph, GLWidget& glwidget)
-  : m_speed(0.001f), m_attraction(0.13f), m_repulsion(50.0f), m_natLength(50.0f), m_controlPointWeight(0.001f),
+  : m_speed(0.001f), m_attraction(0.13f), m_repulsion(50.0f), m_natLength(50.0f), m_controlPointWeight(0.001f), m_theta(1.0f),
     m_graph(graph), m_ui(nullptr), m_forceCalculation(&SpringLayout::forceLTSGraph), m_glwidget(glwidget)
 {
   srand(time(nullptr));
@@ -115,13 +116,24 @@ QVector3D SpringLayout::forceLinearSprings(const QVector3D& a, const QVector3D&
 }
 
 inline
-QVector3D repulsionForce(const QVector3D& a, const QVector3D& b, float repulsion, float natlength)
+QVector3D jitter()
+{
+  return QVector3D(frand(-0.01f, 0.01f), frand(-0.01f, 0.01f), frand(-0.01f, 0.01f));
+}
+
+inline
+QVector3D repulsionForceWithoutJitter(const QVector3D& a, const QVector3D& b, float repulsion, float natlength)
 {
   QVector3D diff = a - b;
   float r = repulsion;
   r /= cube((std::max)(diff.length() / 2.0f, natlength / 10));
-  diff = diff * r + QVector3D(frand(-0.01f, 0.01f), frand(-0.01f, 0.01f), frand(-0.01f, 0.01f));
-  return diff;
+  return diff * r;
+}
+
+inline
+QVector3D repulsionForce(const QVector3D& a, const QVector3D& b, float repulsion, float natlength)
+{
+  return repulsionForceWithoutJitter(a, b, repulsion, natlength) + jitter();
 }
 
 static QVector3D applyForce(const QVector3D& pos, const QVector3D& force, float speed)
@@ -129,6 +141,45 @@ static QVector3D applyForce(const QVector3D& pos, const QVector3D& force, float
   return pos + speed * force;
 }
 
+void SpringLayout::computeRepulsion(const std::vector<QVector3D>& positions, float repulsion, bool planar, std::vector<QVector3D>& forces)
+{
+  m_tree.build(positions, planar);
+  forces.resize(positions.size());
+
+  float natLength = m_natLength;
+  auto pairForce = [repulsion, natLength](const QVector3D& a, const QVector3D& b, float mass)
+  {
+    return repulsionForceWithoutJitter(a, b, repulsion * mass, natLength);
+  };
+  auto computeRange = [&](std::size_t first, std::size_t last)
+  {
+    for (std::size_t i = first; i < last; ++i)
+    {
+      forces[i] = m_tree.force(positions[i], pairForce, m_theta);
+    }
+  };
+
+  // Starting threads only pays off for larger graphs.
+  std::size_t threadCount = (std::max)(std::thread::hardware_concurrency(), 1u);
+  if (positions.size() < 1000 || threadCount == 1)
+  {
+    computeRange(0, positions.size());
+    return;
+  }
+
+  std::vector<std::thread> threads;
+  std::size_t chunk = (positions.size() + threadCount - 1) / threadCount;
+  for (std::size_t first = chunk; first < positions.size(); first += chunk)
+  {
+    threads.emplace_back(computeRange, first, (std::min)(first + chunk, positions.size()));
+  }
+  computeRange(0, chunk);
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+}
+
 void SpringLayout::apply()
 {
   m_graph.lock(GRAPH_LOCK_TRACE); // enter critical section
@@ -144,22 +195,38 @@ void SpringLayout::apply()
     m_lforces.resize(m_graph.edgeCount());
     m_sforces.resize(m_graph.nodeCount());
 
+    // The repulsion between all pairs of nodes, handles and labels is approximated using a Barnes-Hut tree. In 2D,
+    // where the z-coordinates are clipped to a single value, this is a quadtree.
+    bool planar = m_graph.getClipMin().z() == m_graph.getClipMax().z();
+
+    m_positions.resize(nodeCount);
     for (std::size_t i = 0; i < nodeCount; ++i)
     {
-      std::size_t n = sel ? m_graph.explorationNode(i) : i;
+      m_positions[i] = m_graph.node(sel ? m_graph.explorationNode(i) : i).pos();
+    }
+    computeRepulsion(m_positions, m_repulsion, planar, m_repulsionForces);
 
-      m_nforces[n] = QVector3D(0, 0, 0);
-      for (std::size_t j = 0; j < i; ++j)
-      {
-        std::size_t m = sel ? m_graph.explorationNode(j) : j;
+    for (std::size_t i = 0; i < nodeCount; ++i)
+    {
+      std::size_t n = sel ? m_graph.explorationNode(i) : i;
 
-        QVector3D diff = repulsionForce(m_graph.node(n).pos(), m_graph.node(m).pos(), m_repulsion, m_natLength);
-        m_nforces[n] += diff;
-        m_nforces[m] -= diff;
-      }
+      m_nforces[n] = m_repulsionForces[i] + jitter();
       m_sforces[n] = (this->*m_forceCalculation)(m_graph.node(n).pos(), m_graph.stateLabel(n).pos(), 0.0);
     }
 
+    m_positions.resize(edgeCount);
+    for (std::size_t i = 0; i < edgeCount; ++i)
+    {
+      m_positions[i] = m_graph.handle(sel ? m_graph.explorationEdge(i) : i).pos();
+    }
+    computeRepulsion(m_positions, m_repulsion * m_controlPointWeight, planar, m_handleRepulsionForces);
+
+    for (std::size_t i = 0; i < edgeCount; ++i)
+    {
+      m_positions[i] = m_graph.transitionLabel(sel ? m_graph.explorationEdge(i) : i).pos();
+    }
+    computeRepulsion(m_positions, m_repulsion * m_controlPointWeight, planar, m_repulsionForces);
+
     for (std::size_t i = 0; i < edgeCount; ++i)
     {
       std::size_t n = sel ? m_graph.explorationEdge(i) : i;
@@ -168,8 +235,8 @@ void SpringLayout::apply()
       QVector3D f;
       // Variables for repulsion calculations
 
-      m_hforces[n] = QVector3D(0, 0, 0);
-      m_lforces[n] = QVector3D(0, 0, 0);
+      m_hforces[n] = m_handleRepulsionForces[i] + jitter();
+      m_lforces[n] = m_repulsionForces[i] + jitter();
 
       if (e.from() == e.to())
       {
@@ -185,21 +252,6 @@ void SpringLayout::apply()
 
       f = (this->*m_forceCalculation)(m_graph.handle(n).pos(), m_graph.transitionLabel(n).pos(), 0.0);
       m_lforces[n] += f;
-
-      for (std::size_t j = 0; j < i; ++j)
-      {
-        std::size_t m = sel ? m_graph.explorationEdge(j) : j;
-
-        // Handles
-        f = repulsionForce(m_graph.handle(n).pos(), m_graph.handle(m).pos(), m_repulsion * m_controlPointWeight, m_natLength);
-        m_hforces[n] += f;
-        m_hforces[m] -= f;
-
-        // Labels
-        f = repulsionForce(m_graph.transitionLabel(n).pos(), m_graph.transitionLabel(m).pos(), m_repulsion * m_controlPointWeight, m_natLength);
-        m_lforces[n] += f;
-        m_lforces[m] -= f;
-      }
     }
 
     QVector3D clipmin = m_graph.getClipMin();
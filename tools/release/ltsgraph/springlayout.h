@@ -25,6 +25,7 @@
 
 #include "graph.h"
 #include "glwidget.h"
+#include "barneshut.h"
 
 namespace Graph
 {
@@ -48,7 +49,11 @@ class SpringLayout
     float m_repulsion;            ///< The repulsion of other nodes.
     float m_natLength;            ///< The natural length of springs.
     float m_controlPointWeight;   ///< The handle repulsion wight factor.
+    float m_theta;                ///< The accuracy of the Barnes-Hut approximation of the repulsion.
     std::vector<QVector3D> m_nforces, m_hforces, m_lforces, m_sforces;  ///< Vector of the calculated forces..
+    std::vector<QVector3D> m_positions;                                 ///< The positions of the repelling objects.
+    std::vector<QVector3D> m_repulsionForces, m_handleRepulsionForces;  ///< The calculated repulsion forces.
+    BarnesHutTree m_tree;         ///< The tree that is used to approximate the repulsion.
 
     Graph& m_graph;               ///< The graph on which the algorithm is applied.
     SpringLayoutUi* m_ui;         ///< The user interface generated by Qt.
@@ -70,6 +75,15 @@ class SpringLayout
      * @param ideal The ideal distance between @e a and @e b.
      */
     QVector3D forceLTSGraph(const QVector3D& a, const QVector3D& b, float ideal);
+
+    /**
+     * @brief Approximate the repulsion between all pairs of the given positions, using multiple threads.
+     * @param positions The positions of the objects that repel each other.
+     * @param repulsion The repulsion between two objects.
+     * @param planar Indicates that the z-coordinates of the positions can be ignored.
+     * @param forces The vector in which the repulsion on each of the objects is stored.
+     */
+    void computeRepulsion(const std::vector<QVector3D>& positions, float repulsion, bool planar, std::vector<QVector3D>& forces);
   public:
     GLWidget& m_glwidget;
 
@@ -61,8 +61,12 @@ class pg_solver_tool : public rewriter_tool<pbes_input_tool<input_tool> >
                       .add_value(spm_solver, true)
                       .add_value(alternative_spm_solver)
                       .add_value(recursive_solver)
+                      .add_value(parallel_recursive_solver)
                       .add_value(priority_promotion),
                       "Use the solver type NAME:", 's');
+      desc.add_option("threads", make_mandatory_argument("NUM"),
+                      "Use NUM threads for the solver type parrecursive. The default is the number of "
+                      "hardware threads.");
       desc.add_option("scc", "Use scc decomposition", 'c');
       desc.add_option("loop", "Eliminate self-loops", 'L');
       desc.add_option("cycle", "Eliminate cycles", 'C');
@@ -83,6 +87,14 @@ class pg_solver_tool : public rewriter_tool<pbes_input_tool<input_tool> >
       m_options.use_decycle_solver = (parser.options.count("cycle") > 0);
       m_options.verify_solution = (parser.options.count("verify") > 0);
       m_options.only_generate = (parser.options.count("onlygenerate") > 0);
+      if (parser.options.count("threads") > 0)
+      {
+        m_options.number_of_threads = parser.option_argument_as<std::size_t>("threads");
+        if (m_options.number_of_threads == 0)
+        {
+          parser.error("The number of threads must be at least one.");
+        }
+      }
       if (parser.options.count("equation_limit") > 0)
       {
         int limit = parser.option_argument_as<int>("equation_limit");
@@ -70,6 +70,17 @@ class pbessolve_tool: public rewriter_tool<pbes_input_tool<input_tool>>
                  "be an LTS.",
                  'f');
       desc.add_option("prune-todo-list", "Prune the todo list periodically.");
+      desc.add_option("threads",
+                 utilities::make_mandatory_argument("NUM"),
+                 "Use NUM threads to compute the attractor sets while solving the parity game. The solution "
+                 "does not depend on the number of threads, but with more than one thread a different "
+                 "strategy may be computed than with a single thread. For breadth-first search, the "
+                 "equations are also instantiated by NUM threads, which requires a toolset that is built "
+                 "with multi-threading enabled.");
+      desc.add_option("compile-equations",
+                 "Compile the right hand sides of the equations once into programs that are used to instantiate "
+                 "them. The instantiated equations are the same, but they are computed faster. The order in "
+                 "which they are generated may differ.");
       desc.add_option("evidence-file",
                       utilities::make_file_argument("NAME"),
                       "The file to which the evidence is written. If not set, a default name will be chosen.");
@@ -113,8 +124,17 @@ class pbessolve_tool: public rewriter_tool<pbes_input_tool<input_tool>>
       options.aggressive = parser.has_option("aggressive");
       options.prune_todo_list = parser.has_option("prune-todo-list");
       options.prune_todo_alternative = parser.has_option("prune-todo-alternative");
+      options.compile_equations = parser.has_option("compile-equations");
       options.exploration_strategy = parser.option_argument_as<mcrl2::pbes_system::search_strategy>("search");
       options.rewrite_strategy = rewrite_strategy();
+      if (parser.has_option("threads"))
+      {
+        options.number_of_threads = parser.option_argument_as<std::size_t>("threads");
+        if (options.number_of_threads == 0)
+        {
+          parser.error("The number of threads must be at least one.");
+        }
+      }
 
       if (parser.has_option("file"))
       {
@@ -208,7 +228,7 @@ class pbessolve_tool: public rewriter_tool<pbes_input_tool<input_tool>>
         bool result;
         lps::specification evidence;
         timer().start("solving");
-        std::tie(result, evidence) = solve_structure_graph_with_counter_example(G, lpsspec, pbesspec, algorithm.equation_index());
+        std::tie(result, evidence) = solve_structure_graph_with_counter_example(G, lpsspec, pbesspec, algorithm.equation_index(), options.number_of_threads);
         timer().finish("solving");
         std::cout << (result ? "true" : "false") << std::endl;
         if (evidence_file.empty())
@@ -224,7 +244,7 @@ class pbessolve_tool: public rewriter_tool<pbes_input_tool<input_tool>>
         ltsspec.load(ltsfile);
         lts::lts_lts_t evidence;
         timer().start("solving");
-        bool result = solve_structure_graph_with_counter_example(G, ltsspec);
+        bool result = solve_structure_graph_with_counter_example(G, ltsspec, options.number_of_threads);
         timer().finish("solving");
         std::cout << (result ? "true" : "false") << std::endl;
         if (evidence_file.empty())
@@ -237,7 +257,7 @@ class pbessolve_tool: public rewriter_tool<pbes_input_tool<input_tool>>
       else
       {
         timer().start("solving");
-        bool result = solve_structure_graph(G, options.check_strategy);
+        bool result = solve_structure_graph(G, options.check_strategy, options.number_of_threads);
         timer().finish("solving");
         std::cout << (result ? "true" : "false") << std::endl;
       }